@@ -3,10 +3,9 @@
 // Per vertex
 in vec2 in_uv;
 
-// Per instance
-in vec3 in_particlePosition;
+// Per instance -- position and size are uploaded as half floats, colour as normalised bytes
+in vec4 in_particlePositionAndSize;
 in vec4 in_colour;
-in float in_particleSize;
 
 uniform mat4 uniform_modelViewMatrix;
 uniform mat4 uniform_projectionMatrix;
@@ -20,8 +19,8 @@ void main()
     vertex_colour = in_colour;
     vertex_uv = in_uv;
 
-    vec4 cameraSpacePos = uniform_modelViewMatrix * vec4(in_particlePosition, 1.0);
-    cameraSpacePos.xy += in_uv * in_particleSize; // billboard effect
+    vec4 cameraSpacePos = uniform_modelViewMatrix * vec4(in_particlePositionAndSize.xyz, 1.0);
+    cameraSpacePos.xy += in_uv * in_particlePositionAndSize.w; // billboard effect
 
     vec4 cameraSpace0 = uniform_modelViewMatrix * vec4(0.0, 0.0, 0.0, 1.0);
     float fadeZ = cameraSpacePos.z - cameraSpace0.z;
@@ -0,0 +1,723 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 17 Oct 2026 10:41:12am
+
+    Headless processBlock benchmark. Loads every factory preset into a
+    HydraAudioProcessor (no editor), runs audio through it at a range of
+    sample rates and block sizes, and writes the results as JSON.
+
+    HydraBenchmark.jucer is generated from Hydra.jucer, so it always builds
+    the plugin's sources: run GenerateBenchmarkJucer.py from the repository
+    root after adding files to the plugin, then open it in the Projucer.
+
+    With --visualiser, steps the visualiser's particle simulation instead
+    (no OpenGL context needed) at a range of particle counts. Each run ends
+    with a checksum of the instance data, which should only change when the
+    simulation's behaviour is meant to.
+
+    With --dispatch-stress, changes parameters from a background thread at a
+    fixed rate while the message loop runs slow UI callbacks, once through
+    callSyncOrAsync and once through CoalescingDispatcher, and reports how
+    many callbacks were left waiting on the message thread.
+
+    With --lock-stress, calls prepareToPlay and reset from a background
+    thread as fast as possible while processing audio, and reports how many
+    blocks fell back to passing the input through, whether any came out
+    silent, and the worst block time. Exits with 1 if any block came out
+    silent or took longer than --max-block-microseconds (by default the
+    block's own duration), which is how a callback that waited on the lock
+    shows up.
+
+    Usage:
+        HydraBenchmark [--output=results.json] [--wav=input.wav]
+                       [--preset=<name filter>] [--seconds=2]
+                       [--block-sizes=16,64,512] [--sample-rates=44100,96000]
+
+        HydraBenchmark --visualiser [--output=results.json] [--frames=600]
+                       [--particle-counts=1000,10000] [--workers=3]
+
+        HydraBenchmark --dispatch-stress [--output=results.json] [--seconds=2]
+                       [--changes-per-second=10000] [--targets=64]
+                       [--callback-microseconds=200]
+
+        HydraBenchmark --lock-stress [--output=results.json] [--seconds=2]
+                       [--block-size=256] [--max-block-microseconds=<block duration>]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+#include "../Source/PluginProcessor.h"
+#include "../Source/Visualiser/ParticleSimulation.h"
+#include "../Source/MessageThreadUtils.h"
+
+//==============================================================================
+// Allocation counting. Every heap allocation made while isAudioThread is set
+// (i.e. from inside processBlock) is counted, including aligned ones.
+namespace
+{
+    std::atomic<juce::int64> audioThreadAllocations { 0 };
+    thread_local bool isAudioThread = false;
+
+    void* countedAlloc(std::size_t size)
+    {
+        if (isAudioThread)
+            audioThreadAllocations++;
+
+        if (auto* p = std::malloc(size == 0 ? 1 : size))
+            return p;
+
+        throw std::bad_alloc();
+    }
+
+    // Over-aligned types (e.g. the particle store's SIMD lanes) come through these instead
+    void* countedAlignedAlloc(std::size_t size, std::align_val_t alignment)
+    {
+        if (isAudioThread)
+            audioThreadAllocations++;
+
+        const auto align = juce::jmax((std::size_t)alignment, sizeof(void*));
+
+       #if JUCE_WINDOWS
+        if (auto* p = _aligned_malloc(size == 0 ? 1 : size, align))
+            return p;
+       #else
+        void* p = nullptr;
+        if (posix_memalign(&p, align, size == 0 ? 1 : size) == 0)
+            return p;
+       #endif
+
+        throw std::bad_alloc();
+    }
+
+    void alignedFree(void* p) noexcept
+    {
+       #if JUCE_WINDOWS
+        _aligned_free(p);
+       #else
+        std::free(p);
+       #endif
+    }
+}
+
+void* operator new  (std::size_t size)                          { return countedAlloc(size); }
+void* operator new[](std::size_t size)                          { return countedAlloc(size); }
+void* operator new  (std::size_t size, const std::nothrow_t&) noexcept { try { return countedAlloc(size); } catch (...) { return nullptr; } }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { try { return countedAlloc(size); } catch (...) { return nullptr; } }
+void operator delete  (void* p) noexcept                        { std::free(p); }
+void operator delete[](void* p) noexcept                        { std::free(p); }
+void operator delete  (void* p, std::size_t) noexcept           { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept           { std::free(p); }
+void operator delete  (void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+void* operator new  (std::size_t size, std::align_val_t align)  { return countedAlignedAlloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align)  { return countedAlignedAlloc(size, align); }
+void* operator new  (std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { try { return countedAlignedAlloc(size, align); } catch (...) { return nullptr; } }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { try { return countedAlignedAlloc(size, align); } catch (...) { return nullptr; } }
+void operator delete  (void* p, std::align_val_t) noexcept              { alignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept              { alignedFree(p); }
+void operator delete  (void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete  (void* p, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(p); }
+
+//==============================================================================
+struct InputSource
+{
+    juce::String name;
+
+    // Returns stereo audio of the requested length at the requested sample rate
+    std::function<juce::AudioBuffer<float>(double sampleRate, int numSamples)> generate;
+};
+
+/// Log sine sweep with a different start frequency per channel, gated by decaying bursts
+/// and mixed with a little noise, so the analysis modules see frequency, envelope and stereo movement.
+static juce::AudioBuffer<float> createSyntheticInput(double sampleRate, int numSamples)
+{
+    juce::AudioBuffer<float> buffer(2, numSamples);
+    juce::Random random(1234);
+
+    const double duration = numSamples / sampleRate;
+    const double burstPeriod = 0.5;
+
+    for (int channel = 0; channel < 2; channel++)
+    {
+        const double startFreq = (channel == 0) ? 40.0 : 55.0;
+        const double endFreq = 16000.0;
+        const double k = std::log(endFreq / startFreq) / duration;
+        auto* data = buffer.getWritePointer(channel);
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            const double t = i / sampleRate;
+            const double phase = juce::MathConstants<double>::twoPi * startFreq * (std::exp(k * t) - 1.0) / k;
+            const double burstEnvelope = std::exp(-6.0 * std::fmod(t, burstPeriod) / burstPeriod);
+            const double noise = (random.nextDouble() - 0.5) * 0.05;
+            data[i] = (float)(0.5 * burstEnvelope * std::sin(phase) + noise);
+        }
+    }
+
+    return buffer;
+}
+
+/// Reads a whole audio file, resamples it to the requested rate and loops it to the requested length
+static juce::AudioBuffer<float> createFileInput(const juce::File& file, double sampleRate, int numSamples)
+{
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
+    if (!reader)
+        return {};
+
+    juce::AudioBuffer<float> source(2, (int)reader->lengthInSamples);
+    reader->read(&source, 0, (int)reader->lengthInSamples, 0, true, true);
+
+    // Each output sample reads ratio input samples on average, plus the interpolator's latency up front
+    const double ratio = reader->sampleRate / sampleRate;
+    const double latency = juce::LagrangeInterpolator().getBaseLatency();
+    const int resampledLength = (int)((source.getNumSamples() - latency) / ratio);
+    if (resampledLength <= 0)
+        return {};
+
+    juce::AudioBuffer<float> resampled(2, resampledLength);
+    for (int channel = 0; channel < 2; channel++)
+    {
+        juce::LagrangeInterpolator interpolator;
+        interpolator.process(ratio, source.getReadPointer(channel), resampled.getWritePointer(channel),
+                             resampledLength, source.getNumSamples(), 0);
+    }
+
+    juce::AudioBuffer<float> result(2, numSamples);
+    for (int pos = 0; pos < numSamples; pos += resampledLength)
+    {
+        const int count = juce::jmin(resampledLength, numSamples - pos);
+        for (int channel = 0; channel < 2; channel++)
+            result.copyFrom(channel, pos, resampled, channel, 0, count);
+    }
+
+    return result;
+}
+
+//==============================================================================
+struct RunResult
+{
+    double nsPerSample = 0.0;
+    double meanBlockMicroseconds = 0.0;
+    double worstBlockMicroseconds = 0.0;
+    juce::int64 allocations = 0;
+};
+
+static RunResult runBenchmark(HydraAudioProcessor& proc,
+                              const juce::AudioBuffer<float>& input,
+                              double sampleRate,
+                              int blockSize)
+{
+    proc.setRateAndBufferSizeDetails(sampleRate, blockSize);
+    proc.prepareToPlay(sampleRate, blockSize);
+    proc.reset();
+
+    juce::AudioBuffer<float> block(2, blockSize);
+    juce::MidiBuffer midi;
+
+    auto processBlockAt = [&](int startSample) -> juce::int64
+    {
+        const int numSamples = juce::jmin(blockSize, input.getNumSamples() - startSample);
+        block.setSize(2, numSamples, false, false, true);
+        for (int channel = 0; channel < 2; channel++)
+            block.copyFrom(channel, 0, input, channel, startSample, numSamples);
+
+        isAudioThread = true;
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        proc.processBlock(block, midi);
+        const auto endTicks = juce::Time::getHighResolutionTicks();
+        isAudioThread = false;
+
+        return endTicks - startTicks;
+    };
+
+    // Warm up with the first quarter of the input, so that lazy initialisation isn't measured
+    const int warmupSamples = input.getNumSamples() / 4;
+    for (int pos = 0; pos < warmupSamples; pos += blockSize)
+        processBlockAt(pos);
+
+    audioThreadAllocations = 0;
+
+    juce::int64 totalTicks = 0, worstTicks = 0;
+    int numBlocks = 0;
+    for (int pos = 0; pos < input.getNumSamples(); pos += blockSize)
+    {
+        const auto ticks = processBlockAt(pos);
+        totalTicks += ticks;
+        worstTicks = juce::jmax(worstTicks, ticks);
+        numBlocks++;
+    }
+
+    proc.releaseResources();
+
+    RunResult result;
+    result.nsPerSample = juce::Time::highResolutionTicksToSeconds(totalTicks) * 1.0e9 / input.getNumSamples();
+    result.meanBlockMicroseconds = juce::Time::highResolutionTicksToSeconds(totalTicks) * 1.0e6 / juce::jmax(1, numBlocks);
+    result.worstBlockMicroseconds = juce::Time::highResolutionTicksToSeconds(worstTicks) * 1.0e6;
+    result.allocations = audioThreadAllocations.load();
+    return result;
+}
+
+//==============================================================================
+/// Steps the particle simulation with a fixed seed and a scripted activation and mouse path,
+/// so that the final instance data is reproducible for a given build
+static juce::var benchmarkVisualiser(VisualiserProcessor& processor, int numParticles, int numFrames, int numWorkers)
+{
+    *processor.paramNumParticles = numParticles;
+    
+    ParticleSimulation simulation(processor, numWorkers, 1);
+    simulation.setCamera(ParticleSimulation::Camera::fromParameters(processor, 16.0f / 9.0f));
+    simulation.initParticles(true);
+    
+    juce::HeapBlock<ParticleInstance> instances((size_t)simulation.getNumParticles(), true);
+    
+    const float deltaTime = 1.0f / 60.0f;
+    glm::vec2 lastMousePos { 0.0f, 0.0f };
+    
+    auto stepFrame = [&](int frame) -> juce::int64
+    {
+        // Activation rises and falls every 2 seconds; the mouse circles the screen for the second half of each 4 seconds
+        const float t = frame * deltaTime;
+        
+        ParticleSimulation::StepInput input;
+        input.deltaTime = deltaTime;
+        input.activationValue = 0.5f - 0.5f * std::cos(t * juce::MathConstants<float>::pi);
+        
+        const glm::vec2 mousePos { 0.5f * std::cos(t), 0.5f * std::sin(t) };
+        input.useMouse = std::fmod(t, 4.0f) >= 2.0f;
+        input.mouseRay = simulation.getCamera().getRayThroughScreenPoint(mousePos);
+        input.mouseSpeed = glm::distance(lastMousePos, mousePos) / deltaTime;
+        lastMousePos = mousePos;
+        
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        simulation.step(input, instances);
+        return juce::Time::getHighResolutionTicks() - startTicks;
+    };
+    
+    juce::int64 totalTicks = 0, worstTicks = 0;
+    for (int frame = 0; frame < numFrames; frame++)
+    {
+        const auto ticks = stepFrame(frame);
+        totalTicks += ticks;
+        worstTicks = juce::jmax(worstTicks, ticks);
+    }
+    
+    // FNV-1a over the raw bits, so that any change at all shows up
+    juce::uint32 checksum = 2166136261u;
+    auto* bytes = reinterpret_cast<const juce::uint8*>(instances.get());
+    for (size_t i = 0; i < (size_t)simulation.getNumParticles() * sizeof(ParticleInstance); i++)
+        checksum = (checksum ^ bytes[i]) * 16777619u;
+    
+    const double seconds = juce::Time::highResolutionTicksToSeconds(totalTicks);
+    
+    auto* obj = new juce::DynamicObject;
+    obj->setProperty("numParticles", simulation.getNumParticles());
+    obj->setProperty("numFrames", numFrames);
+    obj->setProperty("numWorkers", numWorkers);
+    obj->setProperty("meanFrameMicroseconds", seconds * 1.0e6 / juce::jmax(1, numFrames));
+    obj->setProperty("worstFrameMicroseconds", juce::Time::highResolutionTicksToSeconds(worstTicks) * 1.0e6);
+    obj->setProperty("particlesPerSecond", seconds > 0.0 ? (double)simulation.getNumParticles() * numFrames / seconds : 0.0);
+    obj->setProperty("instanceChecksum", juce::String::toHexString((int)checksum).paddedLeft('0', 8));
+    return juce::var(obj);
+}
+
+//==============================================================================
+template<typename T>
+static juce::Array<T> parseList(const juce::ArgumentList& args, const juce::String& option, const juce::Array<T>& defaultValues)
+{
+    if (!args.containsOption(option))
+        return defaultValues;
+
+    juce::Array<T> values;
+    for (auto& token : juce::StringArray::fromTokens(args.getValueForOption(option), ",", {}))
+    {
+        if constexpr (std::is_integral_v<T>)
+            values.add(token.getIntValue());
+        else
+            values.add(token.getDoubleValue());
+    }
+
+    return values;
+}
+
+//==============================================================================
+static juce::DynamicObject* createResultsRoot()
+{
+    auto* root = new juce::DynamicObject;
+    root->setProperty("plugin", "Hydra");
+    root->setProperty("timestamp", juce::Time::getCurrentTime().toISO8601(true));
+#if JUCE_DEBUG
+    root->setProperty("build", "Debug");
+#else
+    root->setProperty("build", "Release");
+#endif
+    return root;
+}
+
+/// Writes to --output if given, otherwise stdout
+static int writeResults(const juce::ArgumentList& args, juce::DynamicObject* root)
+{
+    const juce::String json = juce::JSON::toString(juce::var(root));
+
+    if (args.containsOption("--output"))
+    {
+        juce::File outputFile = args.getFileForOption("--output");
+        if (!outputFile.replaceWithText(json))
+        {
+            std::cerr << "Failed to write " << outputFile.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        std::cout << json << std::endl;
+    }
+
+    return 0;
+}
+
+//==============================================================================
+struct DispatchSettings
+{
+    double seconds = 2.0;
+    int changesPerSecond = 10000;
+    int numTargets = 64;
+    int callbackMicroseconds = 200;
+};
+
+/// Callbacks waiting to run on the message thread, i.e. the part of the message queue we're responsible for
+struct DispatchCounters
+{
+    std::atomic<int> pending { 0 };
+    std::atomic<int> maxPending { 0 };
+    std::atomic<juce::int64> callbacks { 0 };
+
+    void addPending()
+    {
+        const int now = ++pending;
+        int max = maxPending.load();
+        while (now > max && !maxPending.compare_exchange_weak(max, now)) {}
+    }
+
+    /// Stands in for a UI update, e.g. formatting a value and repainting a label
+    void runCallback(int microseconds)
+    {
+        const auto endTicks = juce::Time::getHighResolutionTicks()
+                            + juce::Time::secondsToHighResolutionTicks(microseconds * 1.0e-6);
+        while (juce::Time::getHighResolutionTicks() < endTicks) {}
+
+        callbacks++;
+        pending--;
+    }
+};
+
+/// Calls change(targetIndex) on the calling thread at the given rate, spread over the targets,
+/// then waits for the message thread to catch up
+static juce::var runDispatchStress(const DispatchSettings& settings, DispatchCounters& counters,
+                                   const std::function<void(int)>& change)
+{
+    const int numChanges = (int)(settings.seconds * settings.changesPerSecond);
+    const double startMs = juce::Time::getMillisecondCounterHiRes();
+
+    audioThreadAllocations = 0;
+    isAudioThread = true;
+    for (int i = 0; i < numChanges; i++)
+    {
+        const double dueMs = startMs + i * 1000.0 / settings.changesPerSecond;
+        while (juce::Time::getMillisecondCounterHiRes() < dueMs)
+            juce::Thread::sleep(1);
+
+        change(i % settings.numTargets);
+    }
+    isAudioThread = false;
+    const auto allocations = audioThreadAllocations.load();
+
+    const double changesDoneMs = juce::Time::getMillisecondCounterHiRes();
+    while (counters.pending > 0)
+        juce::Thread::sleep(1);
+    const double drainedMs = juce::Time::getMillisecondCounterHiRes();
+
+    auto* obj = new juce::DynamicObject;
+    obj->setProperty("changes", numChanges);
+    obj->setProperty("callbacks", counters.callbacks.load());
+    obj->setProperty("maxPendingCallbacks", counters.maxPending.load());
+    obj->setProperty("allocationsPerChange", (double)allocations / juce::jmax(1, numChanges));
+    obj->setProperty("drainMilliseconds", drainedMs - changesDoneMs);
+    return juce::var(obj);
+}
+
+static int runDispatchBenchmark(const juce::ArgumentList& args)
+{
+    DispatchSettings settings;
+    if (args.containsOption("--seconds"))
+        settings.seconds = args.getValueForOption("--seconds").getDoubleValue();
+    if (args.containsOption("--changes-per-second"))
+        settings.changesPerSecond = juce::jmax(1, args.getValueForOption("--changes-per-second").getIntValue());
+    if (args.containsOption("--targets"))
+        settings.numTargets = juce::jmax(1, args.getValueForOption("--targets").getIntValue());
+    if (args.containsOption("--callback-microseconds"))
+        settings.callbackMicroseconds = args.getValueForOption("--callback-microseconds").getIntValue();
+
+    DispatchCounters asyncCounters, coalescedCounters;
+
+    // Targets have to be created on the message thread, which is this one
+    juce::OwnedArray<CoalescingDispatcher::Target> targets;
+    for (int i = 0; i < settings.numTargets; i++)
+        targets.add(new CoalescingDispatcher::Target([&] { coalescedCounters.runCallback(settings.callbackMicroseconds); }));
+
+    juce::var asyncResult, coalescedResult;
+
+    // Parameter changes come from another thread, while this one runs the message loop
+    auto* messageManager = juce::MessageManager::getInstance();
+    juce::Thread::launch([&]
+    {
+        std::cerr << "Dispatch stress: callSyncOrAsync" << std::endl;
+        asyncResult = runDispatchStress(settings, asyncCounters, [&](int)
+        {
+            asyncCounters.addPending();
+            callSyncOrAsync([&] { asyncCounters.runCallback(settings.callbackMicroseconds); });
+        });
+
+        std::cerr << "Dispatch stress: CoalescingDispatcher" << std::endl;
+        coalescedResult = runDispatchStress(settings, coalescedCounters, [&](int targetIndex)
+        {
+            if (targets.getUnchecked(targetIndex)->trigger())
+                coalescedCounters.addPending();
+        });
+
+        messageManager->stopDispatchLoop();
+    });
+
+    messageManager->runDispatchLoop();
+
+    auto* root = createResultsRoot();
+    root->setProperty("changesPerSecond", settings.changesPerSecond);
+    root->setProperty("numTargets", settings.numTargets);
+    root->setProperty("callbackMicroseconds", settings.callbackMicroseconds);
+    root->setProperty("callSyncOrAsync", asyncResult);
+    root->setProperty("coalescingDispatcher", coalescedResult);
+    return writeResults(args, root);
+}
+
+//==============================================================================
+/// Checks that processBlock never blocks or goes silent while another thread holds the graph lock
+static int runLockStressBenchmark(const juce::ArgumentList& args)
+{
+    const double seconds = args.containsOption("--seconds") ? args.getValueForOption("--seconds").getDoubleValue() : 2.0;
+    const int blockSize = args.containsOption("--block-size") ? args.getValueForOption("--block-size").getIntValue() : 256;
+    const double sampleRate = 48000.0;
+    const double maxBlockMicroseconds = args.containsOption("--max-block-microseconds")
+                                            ? args.getValueForOption("--max-block-microseconds").getDoubleValue()
+                                            : blockSize / sampleRate * 1.0e6;
+    const auto maxBlockTicks = (juce::int64)(maxBlockMicroseconds * 1.0e-6 * (double)juce::Time::getHighResolutionTicksPerSecond());
+
+    HydraAudioProcessor proc;
+    proc.setRateAndBufferSizeDetails(sampleRate, blockSize);
+    proc.prepareToPlay(sampleRate, blockSize);
+
+    const auto input = createSyntheticInput(sampleRate, juce::roundToInt(sampleRate));
+
+    std::atomic<bool> shouldStop { false };
+    std::atomic<bool> isPreparing { false };
+    std::atomic<juce::int64> numPrepares { 0 };
+    std::thread preparer([&]
+    {
+        while (!shouldStop)
+        {
+            // Both calls hold the processor's lock for their whole duration
+            isPreparing = true;
+            proc.prepareToPlay(sampleRate, blockSize);
+            proc.reset();
+            isPreparing = false;
+            numPrepares++;
+        }
+    });
+
+    juce::AudioBuffer<float> block(2, blockSize);
+    juce::MidiBuffer midi;
+    juce::int64 numBlocks = 0, numSilentBlocks = 0, numSlowBlocks = 0, numWaits = 0, worstTicks = 0;
+    const auto passThroughBefore = proc.getNumPassThroughBlocks();
+    const double endTime = juce::Time::getMillisecondCounterHiRes() + seconds * 1000.0;
+
+    for (int pos = 0; juce::Time::getMillisecondCounterHiRes() < endTime; pos = (pos + blockSize) % (input.getNumSamples() - blockSize))
+    {
+        for (int channel = 0; channel < 2; channel++)
+            block.copyFrom(channel, 0, input, channel, pos, blockSize);
+
+        const bool startedDuringPrepare = isPreparing;
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        proc.processBlock(block, midi);
+        const auto ticks = juce::Time::getHighResolutionTicks() - startTicks;
+        worstTicks = juce::jmax(worstTicks, ticks);
+
+        // A slow block that started while the lock was held most likely waited for it
+        if (ticks > maxBlockTicks)
+        {
+            numSlowBlocks++;
+            if (startedDuringPrepare)
+                numWaits++;
+        }
+
+        if (block.getMagnitude(0, blockSize) == 0.0f && input.getMagnitude(pos, blockSize) > 0.0f)
+            numSilentBlocks++;
+
+        numBlocks++;
+    }
+
+    shouldStop = true;
+    preparer.join();
+    proc.releaseResources();
+
+    auto* obj = new juce::DynamicObject;
+    obj->setProperty("blockSize", blockSize);
+    obj->setProperty("blocks", numBlocks);
+    obj->setProperty("prepares", numPrepares.load());
+    obj->setProperty("passThroughBlocks", proc.getNumPassThroughBlocks() - passThroughBefore);
+    obj->setProperty("silentBlocks", numSilentBlocks);
+    obj->setProperty("maxBlockMicroseconds", maxBlockMicroseconds);
+    obj->setProperty("slowBlocks", numSlowBlocks);
+    obj->setProperty("slowBlocksStartedDuringPrepare", numWaits);
+    obj->setProperty("worstBlockMicroseconds", juce::Time::highResolutionTicksToSeconds(worstTicks) * 1.0e6);
+
+    auto* root = createResultsRoot();
+    root->setProperty("lockStress", juce::var(obj));
+    const int result = writeResults(args, root);
+
+    if (numSilentBlocks > 0 || numSlowBlocks > 0)
+    {
+        std::cerr << "Lock stress failed: " << numSilentBlocks << " silent blocks, "
+                  << numSlowBlocks << " blocks over " << maxBlockMicroseconds << " us ("
+                  << numWaits << " of them started while the lock was held)" << std::endl;
+        return 1;
+    }
+
+    return result;
+}
+
+static int runVisualiserBenchmark(const juce::ArgumentList& args)
+{
+    const auto particleCounts = parseList<int>(args, "--particle-counts", { 1000, 2500, 5000, 10000 });
+    const int numFrames = args.containsOption("--frames") ? args.getValueForOption("--frames").getIntValue() : 600;
+    const int numWorkers = args.containsOption("--workers") ? args.getValueForOption("--workers").getIntValue()
+                                                            : WorkStealingPool::getDefaultNumWorkers();
+
+    HydraAudioProcessor proc;
+
+    juce::Array<juce::var> results;
+    for (int numParticles : particleCounts)
+    {
+        std::cerr << "Visualiser " << numParticles << " particles, " << numWorkers << " workers" << std::endl;
+        results.add(benchmarkVisualiser(proc.visualiserProcessor, numParticles, numFrames, numWorkers));
+    }
+
+    auto* root = createResultsRoot();
+    root->setProperty("visualiser", results);
+    return writeResults(args, root);
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--visualiser"))
+        return runVisualiserBenchmark(args);
+
+    if (args.containsOption("--dispatch-stress"))
+        return runDispatchBenchmark(args);
+
+    if (args.containsOption("--lock-stress"))
+        return runLockStressBenchmark(args);
+
+    const auto blockSizes = parseList<int>(args, "--block-sizes", { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 });
+    const auto sampleRates = parseList<double>(args, "--sample-rates", { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 });
+    const double seconds = args.containsOption("--seconds") ? args.getValueForOption("--seconds").getDoubleValue() : 2.0;
+    const juce::String presetFilter = args.getValueForOption("--preset");
+
+    juce::Array<InputSource> inputs;
+    inputs.add({ "synthetic", createSyntheticInput });
+
+    if (args.containsOption("--wav"))
+    {
+        juce::File wavFile = args.getFileForOption("--wav");
+        if (!wavFile.existsAsFile())
+        {
+            std::cerr << "Input file not found: " << wavFile.getFullPathName() << std::endl;
+            return 1;
+        }
+
+        inputs.add({ wavFile.getFileName(), [wavFile](double sampleRate, int numSamples) {
+            return createFileInput(wavFile, sampleRate, numSamples);
+        }});
+    }
+
+    HydraAudioProcessor proc;
+    auto& engine = *proc.engine;
+
+    juce::Array<juce::var> results;
+
+    for (int categoryIndex = 0; categoryIndex < engine.getNumPresetCategories(); categoryIndex++)
+    {
+        const auto& category = engine.getPresetCategory(categoryIndex);
+
+        for (auto* preset : category.presets)
+        {
+            if (presetFilter.isNotEmpty() && !preset->name.containsIgnoreCase(presetFilter))
+                continue;
+
+            engine.setSelectedPreset(preset);
+
+            for (auto& inputSource : inputs)
+            {
+                for (double sampleRate : sampleRates)
+                {
+                    const auto input = inputSource.generate(sampleRate, juce::roundToInt(seconds * sampleRate));
+                    if (input.getNumSamples() == 0)
+                    {
+                        std::cerr << "Failed to read input " << inputSource.name << std::endl;
+                        return 1;
+                    }
+
+                    for (int blockSize : blockSizes)
+                    {
+                        std::cerr << category.name << "/" << preset->name << " " << inputSource.name
+                                  << " " << sampleRate << "Hz " << blockSize << " samples" << std::endl;
+
+                        const auto run = runBenchmark(proc, input, sampleRate, blockSize);
+
+                        auto* obj = new juce::DynamicObject;
+                        obj->setProperty("category", category.name);
+                        obj->setProperty("preset", preset->name);
+                        obj->setProperty("input", inputSource.name);
+                        obj->setProperty("sampleRate", sampleRate);
+                        obj->setProperty("blockSize", blockSize);
+                        obj->setProperty("nsPerSample", run.nsPerSample);
+                        obj->setProperty("meanBlockMicroseconds", run.meanBlockMicroseconds);
+                        obj->setProperty("worstBlockMicroseconds", run.worstBlockMicroseconds);
+                        obj->setProperty("audioThreadAllocations", run.allocations);
+                        results.add(juce::var(obj));
+                    }
+                }
+            }
+        }
+    }
+
+    auto* root = createResultsRoot();
+    root->setProperty("results", results);
+
+    return writeResults(args, root);
+}
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+import argparse
+import os
+import re
+
+
+# HydraBenchmark builds the same sources and assets as the plugin, so rather than keeping a second
+# copy of the file list, it is copied from Hydra.jucer into the benchmark's own project settings.
+INSERTION_MARKER = "<!-- Hydra.jucer's file groups are inserted here by GenerateBenchmarkJucer.py -->"
+
+# Sources in the plugin project that can't go into a console app, e.g. because they define their own
+# main(). Matched against the file name only.
+EXCLUDED_FILE_PATTERNS = [r'test_.*\.(c|cpp)$', r'.*_test\.(c|cpp)$']
+
+FILE_ELEMENT = re.compile(r'[ \t]*<FILE\s[^>]*?\bfile="([^"]*)"[^>]*?/>\r?\n', re.DOTALL)
+
+
+def is_excluded(file_path):
+    file_name = os.path.basename(file_path)
+    return any(re.fullmatch(pattern, file_name) for pattern in EXCLUDED_FILE_PATTERNS)
+
+
+def remove_excluded_files(file_groups):
+    def replace(match):
+        if is_excluded(match.group(1)):
+            print("Leaving out", match.group(1))
+            return ''
+        return match.group(0)
+
+    return FILE_ELEMENT.sub(replace, file_groups)
+
+
+def main(plugin_path, template_path, output_path):
+    with open(plugin_path, newline='') as f:
+        plugin = f.read()
+
+    with open(template_path, newline='') as f:
+        template = f.read()
+
+    # Everything between the plugin's <MAINGROUP ...> line and </MAINGROUP>, line endings and all
+    group_start = plugin.index('<MAINGROUP')
+    group_start = plugin.index('\n', group_start) + 1
+    group_end = plugin.rindex('\n', 0, plugin.index('</MAINGROUP>')) + 1
+    file_groups = remove_excluded_files(plugin[group_start:group_end])
+
+    marker_start = template.index(INSERTION_MARKER)
+    marker_start = template.rindex('\n', 0, marker_start) + 1
+    marker_end = template.index('\n', marker_start) + 1
+
+    print("Writing", output_path)
+    with open(output_path, 'w', newline='') as f:
+        f.write(template[:marker_start] + file_groups + template[marker_end:])
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--plugin', required=False, default='./Hydra.jucer', help="Plugin project to take the file list from")
+    parser.add_argument('--template', required=False, default='./Benchmark/HydraBenchmark.jucer.in', help="Benchmark project settings")
+    parser.add_argument('--output', required=False, default='./HydraBenchmark.jucer', help="Name of the Projucer project to generate")
+
+    args = parser.parse_args()
+
+    main(args.plugin, args.template, args.output)
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    AnalysisStatistics.cpp
+    Created: 17 Oct 2026 8:41:03pm
+
+  ==============================================================================
+*/
+
+#include "AnalysisStatistics.h"
+
+//==============================================================================
+void AnalysisStatistics::addModule(AnalysisModule& module)
+{
+    extraModules.addIfNotAlreadyThere(&module);
+}
+
+void AnalysisStatistics::start(AtomicEngine& e)
+{
+    engine = &e;
+    startTimerHz(c_updatesPerSecond);
+}
+
+void AnalysisStatistics::audioProcessed(int numSamples, double newSampleRate)
+{
+    sampleRate.store(newSampleRate, std::memory_order_relaxed);
+    samplesSinceUpdate.fetch_add(numSamples, std::memory_order_relaxed);
+}
+
+void AnalysisStatistics::timerCallback()
+{
+    // Only sample once another update period of audio has been processed. If the timer has fallen
+    // behind, the missed updates are dropped rather than repeating the same values.
+    const int samplesPerUpdate = juce::jmax(1, juce::roundToInt(sampleRate.load(std::memory_order_relaxed) / c_updatesPerSecond));
+    if (samplesSinceUpdate.load(std::memory_order_relaxed) < samplesPerUpdate)
+        return;
+
+    samplesSinceUpdate.store(0, std::memory_order_relaxed);
+
+    // Slots are handed out in the order modules are visited. If the engine's modules change (e.g. on a
+    // preset load), a slot that now sees a different feature starts again from scratch.
+    int slotIndex = 0;
+    auto visit = [this, &slotIndex](auto& module)
+    {
+        for (int i = 0; i < module.getNumFeatures() && slotIndex < c_maxFeatures; i++)
+            update(slots[slotIndex++], module, i);
+    };
+
+    for (auto* module : extraModules)
+        visit(*module);
+
+    if (engine != nullptr)
+        engine->forEachAnalysisModule(visit);
+
+    jassert(slotIndex < c_maxFeatures);
+
+    // Anything beyond the last feature belonged to modules that have gone
+    for (; slotIndex < c_maxFeatures && slots[slotIndex].module != nullptr; slotIndex++)
+        slots[slotIndex].module = nullptr;
+}
+
+void AnalysisStatistics::update(Slot& slot, AnalysisModule& module, int featureIndex)
+{
+    if (slot.module != &module || slot.featureIndex != featureIndex)
+    {
+        slot.percentile.reset();
+        slot.variance.reset();
+        slot.module = &module;
+        slot.featureIndex = featureIndex;
+    }
+
+    const double value = module.getLastValue(featureIndex);
+    slot.percentile.addValue(value);
+    slot.variance.addValue(value);
+}
+
+bool AnalysisStatistics::getValues(const AnalysisModule& module, int featureIndex, Values& result) const
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    for (const auto& slot : slots)
+    {
+        if (slot.module == nullptr)
+            break;
+
+        if (slot.module == &module && slot.featureIndex == featureIndex)
+        {
+            result.percentile = (float)slot.percentile.getEstimate();
+            result.standardDeviation = (float)slot.variance.getStandardDeviation();
+            return true;
+        }
+    }
+
+    return false;
+}
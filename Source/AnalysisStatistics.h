@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    AnalysisStatistics.h
+    Created: 17 Oct 2026 8:41:03pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "../atomicengine/AtomicEngine.h"
+#include "../atomicengine/Analysis/AnalysisModule.h"
+#include "StreamingStatistics.h"
+
+//==============================================================================
+/// Streaming 90th percentile and standard deviation of every analysis feature.
+///
+/// Sampled at a fixed rate in audio time, so the results depend on neither the block size
+/// nor whether an editor is open, and don't fill up with stale values while the host is
+/// stopped. The audio thread only counts samples: the engine rebuilds its analysis modules
+/// on the message thread when a preset is loaded, so they are only ever walked there.
+class AnalysisStatistics  : private juce::Timer
+{
+public:
+    static constexpr int c_maxFeatures = 128;
+    static constexpr int c_updatesPerSecond = 100;
+    static constexpr double c_percentile = 0.9;
+
+    /// Modules to follow as well as the engine's own, e.g. the plugin's meters
+    void addModule(AnalysisModule& module);
+
+    /// Starts sampling the engine's modules. The engine must outlive this.
+    void start(AtomicEngine& engine);
+
+    /// Called from processBlock. Lock-free and doesn't allocate.
+    void audioProcessed(int numSamples, double sampleRate);
+
+    struct Values
+    {
+        float percentile = 0.0f;
+        float standardDeviation = 0.0f;
+    };
+
+    /// Message thread only. Returns false if the feature isn't being followed (yet).
+    bool getValues(const AnalysisModule& module, int featureIndex, Values& result) const;
+
+private:
+    struct Slot
+    {
+        // Which feature this slot currently holds
+        const AnalysisModule* module = nullptr;
+        int featureIndex = -1;
+
+        P2Quantile percentile { c_percentile };
+        RunningVariance variance;
+    };
+
+    Slot slots[c_maxFeatures];
+    juce::Array<AnalysisModule*> extraModules;
+    AtomicEngine* engine = nullptr;
+
+    std::atomic<int> samplesSinceUpdate { 0 };
+    std::atomic<double> sampleRate { 44100.0 };
+
+    void timerCallback() override;
+    void update(Slot& slot, AnalysisModule& module, int featureIndex);
+};
@@ -12,8 +12,10 @@
 
 #include <JuceHeader.h>
 
+#include "RefreshScheduler.h"
+
 //==============================================================================
-class AnimatedIcon  : public juce::Component, public juce::Timer
+class AnimatedIcon  : public juce::Component, private RefreshScheduler::Client
 {
 public:
     enum State { Dead, Advance, Alive, Retreat };
@@ -22,7 +24,6 @@ public:
     {
         setInterceptsMouseClicks(false, false);
         currentGradient.addColour(0, juce::Colours::red);
-        startTimer(30);
     }
 
     ~AnimatedIcon() override
@@ -90,7 +91,7 @@ public:
             currentGradient = retreatGradient;
         
         currentGradient.addColour(colourPos, currentColour);
-        startTimer(100);
+        lastStepTime = juce::Time::getMillisecondCounterHiRes();
     }
     
     void paint (juce::Graphics& g) override
@@ -109,41 +110,56 @@ public:
         icon.scaleToFit(0, 0, getWidth(), getHeight(), true);
     }
     
-    void timerCallback() override
+    void refresh() override
     {
-        switch (currentState)
-        {
-            case Dead:
-            case Alive:
-                return;
-            case Advance:
-                colourPos += difference;
-                break;
-            case Retreat:
-                colourPos -= difference;
-                break;
-        }
+        if (currentState == Dead || currentState == Alive)
+            return;
+        
+        // The fade moves on by difference every c_stepIntervalMs, however often this is called
+        const double now = juce::Time::getMillisecondCounterHiRes();
+        const float steps = (float)((now - lastStepTime) / c_stepIntervalMs);
+        lastStepTime = now;
+        
+        if (currentState == Advance)
+            colourPos += difference * steps;
+        else
+            colourPos -= difference * steps;
         
         if (colourPos >= 1.0f)
         {
             colourPos = 1.0f;
             currentState = Alive;
-            stopTimer();
         }
         else if (colourPos <= 0.0f)
         {
             colourPos = 0.0f;
             currentState = Dead;
-            stopTimer();
         }
 
-        repaint();
+        // Repaint at the old 100ms rate, except to show the end of the fade straight away, and
+        // not at all if the colour hasn't visibly moved
+        const bool isFinished = currentState == Dead || currentState == Alive;
+        if (!isFinished && now - lastRepaintTime < c_stepIntervalMs)
+            return;
+        
+        const auto colour = currentGradient.getColourAtPosition(colourPos).getARGB();
+        if (colour != lastPaintedColour)
+        {
+            lastPaintedColour = colour;
+            lastRepaintTime = now;
+            repaint();
+        }
     }
 
 private:
+    static constexpr double c_stepIntervalMs = 100.0;
+    
     State currentState = Dead;
     float colourPos = 0.0f;
     float difference = 0.02f;
+    double lastStepTime = 0.0;
+    double lastRepaintTime = 0.0;
+    juce::uint32 lastPaintedColour = 0;
     juce::Path icon;
     
     juce::ColourGradient advanceGradient, retreatGradient, currentGradient;
@@ -9,7 +9,6 @@
 */
 
 #include "ParameterValueDisplay.h"
-#include "../MessageThreadUtils.h"
 
 ParameterValueDisplay::ParameterValueDisplay()
 {
@@ -47,7 +46,7 @@ void ParameterValueDisplay::resized()
 
 void ParameterValueDisplay::parameterValueChanged (int parameterIndex, float newValue)
 {
-    callSyncOrAsync([this] { valueLabel.setText(formattedValue(), juce::dontSendNotification); });
+    parameterUpdate.trigger();
 }
 
 void ParameterValueDisplay::parameterGestureChanged (int parameterIndex, bool gestureIsStarting)
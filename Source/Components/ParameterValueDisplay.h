@@ -12,6 +12,7 @@
 
 #include <JuceHeader.h>
 #include "../GraphicsGlobals.h"
+#include "../MessageThreadUtils.h"
 
 class ParameterValueDisplay
 : public juce::Component
@@ -36,4 +37,5 @@ private:
     juce::Label valueLabel;
     juce::ImageComponent backgroundImage;
     juce::RangedAudioParameter* param;
+    CoalescingDispatcher::Target parameterUpdate { [this] { valueLabel.setText(formattedValue(), juce::dontSendNotification); } };
 };
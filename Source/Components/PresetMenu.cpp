@@ -431,11 +431,8 @@ bool PresetMenu::testFilter(const AtomicEngine::Preset *preset)
             break;
             
         case FilterType::Suggested:
-            for (auto* tag : preset->tags)
-            {
-                if (!tag->isTagActive())
-                    return false;
-            }
+            if ((getRequiredTags(preset) & ~activeTags).any())
+                return false;
             break;
             
         case FilterType::Favourites:
@@ -461,10 +458,74 @@ bool PresetMenu::testFilter(const AtomicEngine::Snapshot *snapshot)
     return true;
 }
 
+const PresetMenu::TagMask& PresetMenu::getRequiredTags(const AtomicEngine::Preset* preset)
+{
+    auto found = requiredTagMasks.find(preset);
+    if (found != requiredTagMasks.end())
+        return found->second;
+    
+    TagMask mask;
+    for (auto* tag : preset->tags)
+    {
+        int bit = soundTags.indexOf(tag);
+        if (bit < 0)
+        {
+            if (soundTags.size() >= c_maxSoundTags)
+            {
+                // Out of bits, so this tag can't be filtered on
+                jassertfalse;
+                continue;
+            }
+            
+            bit = soundTags.size();
+            soundTags.add(tag);
+            activeTags[(size_t)bit] = tag->isTagActive();
+        }
+        
+        mask.set((size_t)bit);
+    }
+    
+    return requiredTagMasks.emplace(preset, mask).first->second;
+}
+
+PresetMenu::TagMask PresetMenu::evaluateActiveTags() const
+{
+    TagMask mask;
+    for (int i = 0; i < soundTags.size(); i++)
+        mask[(size_t)i] = soundTags.getUnchecked(i)->isTagActive();
+    
+    return mask;
+}
+
+void PresetMenu::clearTagMasks()
+{
+    soundTags.clear();
+    requiredTagMasks.clear();
+    activeTags.reset();
+}
+
+void PresetMenu::refresh()
+{
+    if (getCurrentFilterType() != FilterType::Suggested)
+        return;
+    
+    // Rebuild if an engine callback threw the masks away, or if any tag has changed state
+    if (tagMasksAreStale || evaluateActiveTags() != activeTags)
+    {
+        populatePresetList();
+        populateSnapshotList();
+    }
+}
+
 void PresetMenu::populatePresetList()
 {
     filteredPresets.clear();
     
+    // Only the presets listed below are masked, and the tags are re-read from them, so nothing
+    // here outlives the preset pointers the lists already hold
+    clearTagMasks();
+    tagMasksAreStale = false;
+    
     auto* currentPreset = processor.engine->getSelectedPreset();
     int selectionIndex = -1;
     if (currentPreset)
@@ -601,6 +662,10 @@ void PresetMenu::updateSelection()
 //==============================================================================
 void PresetMenu::engineSelectedPresetChanged()
 {
+    // This is also how preset reloads and state loads show up, after which the tags may be gone
+    clearTagMasks();
+    tagMasksAreStale = true;
+    
     updateSelection();
     populateSnapshotList();
 }
@@ -612,6 +677,9 @@ void PresetMenu::engineSelectedSnapshotChanged()
 
 void PresetMenu::engineSnapshotsChangedForPreset(const AtomicEngine::Preset &preset)
 {
+    clearTagMasks();
+    tagMasksAreStale = true;
+    
     if (&preset == processor.engine->getSelectedPreset())
         populateSnapshotList();
 }
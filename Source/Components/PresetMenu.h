@@ -11,7 +11,10 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <bitset>
+#include <unordered_map>
 #include "GradientLabel.h"
+#include "RefreshScheduler.h"
 #include "../PluginProcessor.h"
 
 //==============================================================================
@@ -35,7 +38,7 @@ private:
 };
 
 //==============================================================================
-class PresetMenu  : public juce::Component, public AtomicEngine::Listener
+class PresetMenu  : public juce::Component, public AtomicEngine::Listener, private RefreshScheduler::Client
 {
 public:
     PresetMenu(HydraAudioProcessor& p);
@@ -79,6 +82,25 @@ private:
     
     bool testFilter(const AtomicEngine::Preset* preset);
     bool testFilter(const AtomicEngine::Snapshot* snapshot);
+    
+    // Every sound tag used by a listed preset gets a bit, so the Suggested filter is one mask test
+    // per preset, and tags are evaluated once per refresh rather than once per preset that uses them.
+    // Rebuilt whenever the preset list is, and cleared whenever the engine's presets change.
+    static constexpr int c_maxSoundTags = 128;
+    using TagMask = std::bitset<c_maxSoundTags>;
+    
+    juce::Array<SoundTag*> soundTags;
+    std::unordered_map<const AtomicEngine::Preset*, TagMask> requiredTagMasks;
+    TagMask activeTags;
+    bool tagMasksAreStale = false;
+    
+    void clearTagMasks();
+    
+    const TagMask& getRequiredTags(const AtomicEngine::Preset* preset);
+    TagMask evaluateActiveTags() const;
+    
+    /// Keeps the Suggested list live, repopulating it only when the set of active tags changes
+    void refresh() override;
 
     juce::Array<const AtomicEngine::Preset*> filteredPresets;
     juce::Array<const AtomicEngine::Snapshot*> filteredSnapshots;
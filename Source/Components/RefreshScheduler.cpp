@@ -0,0 +1,83 @@
+/*
+  ==============================================================================
+
+    RefreshScheduler.cpp
+    Created: 17 Oct 2026 5:46:50pm
+
+  ==============================================================================
+*/
+
+#include "RefreshScheduler.h"
+
+//==============================================================================
+RefreshScheduler::RefreshScheduler()
+{
+}
+
+RefreshScheduler::~RefreshScheduler()
+{
+    stopTimer();
+}
+
+void RefreshScheduler::timerCallback()
+{
+    refreshClients();
+}
+
+void RefreshScheduler::vblank()
+{
+    // With several editors open, each one's vblank arrives at almost the same moment; whichever comes
+    // first refreshes, so clients aren't refreshed more than once a frame. Any attachment can drive
+    // this, so a hidden or minimised editor that stops getting vblanks doesn't stall the others.
+    const double now = juce::Time::getMillisecondCounterHiRes();
+    if (now - lastRefreshTime < c_minRefreshIntervalMs)
+        return;
+    
+    lastRefreshTime = now;
+    refreshClients();
+}
+
+void RefreshScheduler::refreshClients()
+{
+    clients.call([](Client& client) { client.refresh(); });
+}
+
+void RefreshScheduler::updateTimer()
+{
+    if (displayAttachments.isEmpty() && !clients.isEmpty())
+    {
+        if (!isTimerRunning())
+            startTimerHz(c_fallbackRefreshRateHz);
+    }
+    else
+    {
+        stopTimer();
+    }
+}
+
+//==============================================================================
+RefreshScheduler::Client::Client()
+{
+    scheduler->clients.add(this);
+    scheduler->updateTimer();
+}
+
+RefreshScheduler::Client::~Client()
+{
+    scheduler->clients.remove(this);
+    scheduler->updateTimer();
+}
+
+//==============================================================================
+RefreshScheduler::DisplayAttachment::DisplayAttachment(juce::Component& component)
+: vblankAttachment(&component, [this] { scheduler->vblank(); })
+{
+    scheduler->displayAttachments.add(this);
+    scheduler->updateTimer();
+}
+
+RefreshScheduler::DisplayAttachment::~DisplayAttachment()
+{
+    scheduler->displayAttachments.removeFirstMatchingValue(this);
+    scheduler->updateTimer();
+}
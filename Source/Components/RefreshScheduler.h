@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    RefreshScheduler.h
+    Created: 17 Oct 2026 5:46:50pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/// Polls every UI element that shows live data from a single callback per display frame,
+/// instead of each one running its own timer. Repaints requested from the same callback are
+/// coalesced by JUCE into one paint pass.
+///
+/// Shared between every editor in the process. While any editor holds a DisplayAttachment,
+/// refreshes follow the display vblank, taking whichever attachment fires first each frame;
+/// otherwise a 60Hz timer is used.
+class RefreshScheduler : private juce::Timer
+{
+public:
+    RefreshScheduler();
+    ~RefreshScheduler() override;
+
+    //==========================================================================
+    class Client
+    {
+    public:
+        Client();
+        virtual ~Client();
+
+        /// Called once per frame on the message thread. Poll data sources here, and only
+        /// repaint if the change would actually be visible.
+        virtual void refresh() = 0;
+
+    private:
+        juce::SharedResourcePointer<RefreshScheduler> scheduler;
+
+        JUCE_DECLARE_NON_COPYABLE (Client)
+    };
+
+    //==========================================================================
+    class DisplayAttachment
+    {
+    public:
+        explicit DisplayAttachment(juce::Component& component);
+        ~DisplayAttachment();
+
+    private:
+        juce::SharedResourcePointer<RefreshScheduler> scheduler;
+        juce::VBlankAttachment vblankAttachment;
+
+        JUCE_DECLARE_NON_COPYABLE (DisplayAttachment)
+    };
+
+private:
+    static constexpr int c_fallbackRefreshRateHz = 60;
+    
+    // Vblanks closer together than this are the same frame seen by different attachments
+    static constexpr double c_minRefreshIntervalMs = 4.0;
+    double lastRefreshTime = 0.0;
+
+    juce::ListenerList<Client> clients;
+    juce::Array<DisplayAttachment*> displayAttachments;
+
+    void timerCallback() override;
+    void vblank();
+    void refreshClients();
+    void updateTimer();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RefreshScheduler)
+};
@@ -16,7 +16,6 @@
 //==============================================================================
 VolumeMeter::VolumeMeter()
 {
-    startTimerHz(60);
 }
 
 VolumeMeter::~VolumeMeter()
@@ -30,14 +29,16 @@ void VolumeMeter::setProcessorAndChannel(bsfx::VolumeMeter *processor_, int chan
     repaint();
 }
 
-void VolumeMeter::timerCallback()
+void VolumeMeter::refresh()
 {
     if (processor)
     {
         float value = processor->getMeterValue01(channel);
         value = juce::jlimit(0.0f, 1.0f, value);
         
-        if (value != lastValue)
+        // Only repaint once the bar would move by at least half a pixel
+        const float threshold = 0.5f / (float)juce::jmax(1, getHeight());
+        if (std::abs(value - lastValue) >= threshold || (value != lastValue && (value == 0.0f || value == 1.0f)))
         {
             updateMeterValue(value);
             lastValue = value;
@@ -97,13 +98,10 @@ HydraVolumeMeter::HydraVolumeMeter()
     
     addAndMakeVisible(leftMeter);
     addAndMakeVisible(rightMeter);
-    
-    startTimerHz(60);
 }
     
 HydraVolumeMeter::~HydraVolumeMeter()
 {
-    stopTimer();
 }
 
 void HydraVolumeMeter::setTitle(juce::String string)
@@ -136,8 +134,11 @@ void HydraVolumeMeter::resized()
     rightMeter.setBounds(meterBounds.removeFromRight(2));
 }
 
-void HydraVolumeMeter::timerCallback()
+void HydraVolumeMeter::refresh()
 {
+    if (!processor)
+        return;
+    
     float valueL, valueR, max;
     
     valueL = processor->getMeterValue(0);
@@ -152,6 +153,7 @@ void HydraVolumeMeter::timerCallback()
     else if (string == "0.00")
         string = "+0.00";
     
+    // Label only repaints if the text has changed
     level.setText(string, juce::dontSendNotification);
 }
 
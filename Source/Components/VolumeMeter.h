@@ -12,11 +12,12 @@
 #include <JuceHeader.h>
 
 #include "../../atomicengine/bsfx/VolumeMeter.h"
+#include "RefreshScheduler.h"
 
 //==============================================================================
 class VolumeMeter
 : public juce::Component
-, private juce::Timer
+, private RefreshScheduler::Client
 {
 public:
     VolumeMeter();
@@ -24,7 +25,7 @@ public:
 
     void setProcessorAndChannel(bsfx::VolumeMeter* processor, int channel);
 
-    void timerCallback() override;
+    void refresh() override;
     void paint (juce::Graphics&) override;
    
 private:
@@ -43,7 +44,7 @@ private:
 //==============================================================================
 class HydraVolumeMeter
 : public juce::Component
-, private juce::Timer
+, private RefreshScheduler::Client
 {
 public:
     HydraVolumeMeter();
@@ -55,7 +56,7 @@ public:
     void paint(juce::Graphics& g) override;
     void resized() override;
     
-    void timerCallback() override;
+    void refresh() override;
     
 private:
     juce::Label title, level, db;
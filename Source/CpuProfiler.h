@@ -0,0 +1,241 @@
+/*
+  ==============================================================================
+
+    CpuProfiler.h
+    Created: 17 Oct 2026 11:20:05am
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#ifndef HYDRA_ENABLE_PROFILING
+ #if HYDRA_ENABLE_DEV_MODE
+  #define HYDRA_ENABLE_PROFILING 1
+ #else
+  #define HYDRA_ENABLE_PROFILING 0
+ #endif
+#endif
+
+//==============================================================================
+/// Collects timing histograms for named sections of code.
+/// Each section must only be measured from a single thread (e.g. the audio thread); stats can be
+/// read and reset from any other thread without locking.
+class CpuProfiler
+{
+public:
+    //==========================================================================
+    class Section
+    {
+    public:
+        explicit Section(const juce::String& n) : name(n) { clear(); }
+
+        const juce::String name;
+
+        /// Called from the measuring thread only
+        void addMeasurement(juce::int64 ticks) noexcept
+        {
+            if (resetRequested.exchange(false, std::memory_order_acquire))
+                clear();
+
+            const auto value = (juce::uint64)juce::jmax((juce::int64)0, ticks);
+            auto& bucket = buckets[getBucketIndex(value)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            totalTicks.store(totalTicks.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            if (value > maxTicks.load(std::memory_order_relaxed))
+                maxTicks.store(value, std::memory_order_relaxed);
+            count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        struct Stats
+        {
+            juce::uint64 count = 0;
+            double meanMicroseconds = 0.0;
+            double p99Microseconds = 0.0;
+            double maxMicroseconds = 0.0;
+        };
+
+        /// Safe to call from any thread. Values may be very slightly inconsistent with each other
+        /// if a measurement is being added at the same time, which is fine for display purposes.
+        Stats getStats() const
+        {
+            Stats stats;
+            stats.count = count.load(std::memory_order_acquire);
+            if (stats.count == 0)
+                return stats;
+
+            stats.meanMicroseconds = ticksToMicroseconds((double)totalTicks.load(std::memory_order_relaxed) / (double)stats.count);
+            stats.maxMicroseconds = ticksToMicroseconds((double)maxTicks.load(std::memory_order_relaxed));
+
+            juce::uint64 histogramCount = 0;
+            for (auto& bucket : buckets)
+                histogramCount += bucket.load(std::memory_order_relaxed);
+
+            const auto p99Rank = (juce::uint64)std::ceil(0.99 * (double)histogramCount);
+            juce::uint64 cumulative = 0;
+            for (int i = 0; i < c_numBuckets; i++)
+            {
+                cumulative += buckets[i].load(std::memory_order_relaxed);
+                if (cumulative >= p99Rank)
+                {
+                    // Report the upper edge of the bucket, but never more than the observed maximum
+                    stats.p99Microseconds = juce::jmin(ticksToMicroseconds((double)getBucketUpperBound(i)),
+                                                       stats.maxMicroseconds);
+                    break;
+                }
+            }
+
+            return stats;
+        }
+
+        /// Safe to call from any thread; the measuring thread clears the data before its next measurement
+        void reset() noexcept
+        {
+            resetRequested.store(true, std::memory_order_release);
+        }
+
+    private:
+        // Buckets are log2-spaced with 4 sub-buckets per octave, giving better than 25% resolution
+        static constexpr int c_subBucketBits = 2;
+        static constexpr int c_numBuckets = (32 - c_subBucketBits + 1) << c_subBucketBits;
+
+        static int getBucketIndex(juce::uint64 ticks) noexcept
+        {
+            const auto value = (juce::uint32)juce::jmin(ticks, (juce::uint64)0xFFFFFFFF);
+            if (value < (1u << c_subBucketBits))
+                return (int)value;
+
+            const int highestBit = juce::findHighestSetBit(value);
+            const int subBucket = (int)(value >> (highestBit - c_subBucketBits)) & ((1 << c_subBucketBits) - 1);
+            return ((highestBit - c_subBucketBits + 1) << c_subBucketBits) + subBucket;
+        }
+
+        static juce::uint64 getBucketUpperBound(int index) noexcept
+        {
+            if (index < (1 << c_subBucketBits))
+                return (juce::uint64)index + 1;
+
+            const int shift = (index >> c_subBucketBits) - 1;
+            const juce::uint64 subBucket = (juce::uint64)(index & ((1 << c_subBucketBits) - 1));
+            return ((1 << c_subBucketBits) + subBucket + 1) << shift;
+        }
+
+        static double ticksToMicroseconds(double ticks)
+        {
+            return ticks * 1.0e6 / (double)juce::Time::getHighResolutionTicksPerSecond();
+        }
+
+        void clear() noexcept
+        {
+            for (auto& bucket : buckets)
+                bucket.store(0, std::memory_order_relaxed);
+            totalTicks.store(0, std::memory_order_relaxed);
+            maxTicks.store(0, std::memory_order_relaxed);
+            count.store(0, std::memory_order_release);
+        }
+
+        std::atomic<juce::uint32> buckets[c_numBuckets];
+        std::atomic<juce::uint64> totalTicks, maxTicks, count;
+        std::atomic<bool> resetRequested { false };
+
+        JUCE_DECLARE_NON_COPYABLE(Section)
+    };
+
+    //==========================================================================
+    /// Measures the lifetime of the object into the given section, if profiling is enabled
+    class ScopedMeasurement
+    {
+    public:
+        ScopedMeasurement(CpuProfiler& p, Section& s) noexcept
+        : section(p.isEnabled() ? &s : nullptr)
+        , startTicks(section ? juce::Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedMeasurement() noexcept
+        {
+            if (section)
+                section->addMeasurement(juce::Time::getHighResolutionTicks() - startTicks);
+        }
+
+    private:
+        Section* const section;
+        const juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedMeasurement)
+    };
+
+    //==========================================================================
+    /// Not thread safe -- add all sections before processing starts
+    Section& addSection(const juce::String& name)
+    {
+        return *sections.add(new Section(name));
+    }
+
+    int getNumSections() const { return sections.size(); }
+    Section& getSection(int index) const { return *sections.getUnchecked(index); }
+
+    void setEnabled(bool shouldBeEnabled) noexcept { enabled.store(shouldBeEnabled, std::memory_order_relaxed); }
+    bool isEnabled() const noexcept { return enabled.load(std::memory_order_relaxed); }
+
+    void resetAll()
+    {
+        for (auto* section : sections)
+            section->reset();
+    }
+
+    /// Plain-text summary of all sections, one per line
+    juce::String getReport() const
+    {
+        juce::String report;
+        for (auto* section : sections)
+        {
+            auto stats = section->getStats();
+            report << juce::String::formatted("%-24s mean %8.2f us   p99 %8.2f us   max %8.2f us   (%llu blocks)",
+                                              section->name.toRawUTF8(),
+                                              stats.meanMicroseconds,
+                                              stats.p99Microseconds,
+                                              stats.maxMicroseconds,
+                                              (unsigned long long)stats.count)
+                   << juce::newLine;
+        }
+        return report;
+    }
+
+private:
+    juce::OwnedArray<Section> sections;
+    std::atomic<bool> enabled { true };
+};
+
+#if HYDRA_ENABLE_PROFILING
+ #define HYDRA_PROFILE_SCOPE(profiler, section) \
+    CpuProfiler::ScopedMeasurement JUCE_JOIN_MACRO(profileScope_, __LINE__) (profiler, section)
+#else
+ #define HYDRA_PROFILE_SCOPE(profiler, section)
+#endif
+
+//==============================================================================
+/// A graph node that times its own processBlock into a profiler section, e.g.
+/// new ProfiledProcessor<bsfx::GainDB>(profiler, profiler.addSection("inputGain"), -12.0f, 12.0f, 0.0f)
+template<typename ProcessorType>
+class ProfiledProcessor  : public ProcessorType
+{
+public:
+    template<typename... Args>
+    ProfiledProcessor(CpuProfiler& p, CpuProfiler::Section& s, Args&&... args)
+    : ProcessorType(std::forward<Args>(args)...), profiler(p), section(s)
+    {
+    }
+
+    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override
+    {
+        HYDRA_PROFILE_SCOPE(profiler, section);
+        ProcessorType::processBlock(buffer, midiMessages);
+    }
+
+private:
+    CpuProfiler& profiler;
+    CpuProfiler::Section& section;
+};
@@ -24,3 +24,74 @@ inline void callSyncOrAsync(std::function<void()> f)
         juce::MessageManager::callAsync(f);
     }
 }
+
+//==============================================================================
+/// Runs callbacks on the message thread on behalf of other threads, merging repeated requests.
+///
+/// Unlike callSyncOrAsync, a burst of triggers (e.g. a parameter automated at audio rate) doesn't
+/// flood the message queue: each Target has a dirty flag, and the dispatcher calls every dirty
+/// target once per message loop tick. There is never more than one message in the queue, and
+/// triggering doesn't allocate, so it is safe from the audio thread.
+class CoalescingDispatcher : private juce::AsyncUpdater
+{
+public:
+    class Target
+    {
+    public:
+        /// Must be created and destroyed on the message thread
+        explicit Target(std::function<void()> callbackToUse)
+        : callback(std::move(callbackToUse))
+        {
+            JUCE_ASSERT_MESSAGE_THREAD
+            dispatcher->targets.add(this);
+        }
+
+        ~Target()
+        {
+            JUCE_ASSERT_MESSAGE_THREAD
+            dispatcher->targets.removeFirstMatchingValue(this);
+        }
+
+        /// If called from the message thread, calls the callback synchronously. Otherwise, marks
+        /// the target dirty; returns true if it wasn't already, i.e. a callback is newly pending.
+        bool trigger()
+        {
+            if (juce::MessageManager::existsAndIsCurrentThread())
+            {
+                dirty.store(false, std::memory_order_relaxed);
+                callback();
+                return false;
+            }
+
+            if (dirty.exchange(true, std::memory_order_acq_rel))
+                return false;
+
+            dispatcher->triggerAsyncUpdate();
+            return true;
+        }
+
+    private:
+        friend class CoalescingDispatcher;
+
+        std::function<void()> callback;
+        std::atomic<bool> dirty { false };
+        juce::SharedResourcePointer<CoalescingDispatcher> dispatcher;
+
+        JUCE_DECLARE_NON_COPYABLE (Target)
+    };
+
+private:
+    // Only touched on the message thread
+    juce::Array<Target*> targets;
+
+    void handleAsyncUpdate() override
+    {
+        // Indexed rather than range-based, as a callback may delete targets
+        for (int i = 0; i < targets.size(); i++)
+        {
+            auto* target = targets.getUnchecked(i);
+            if (target->dirty.exchange(false, std::memory_order_acq_rel))
+                target->callback();
+        }
+    }
+};
@@ -13,28 +13,59 @@
 #include <JuceHeader.h>
 
 #include "../../atomicengine/Analysis/AnalysisModule.h"
+#include "../Components/RefreshScheduler.h"
+#include "../AnalysisStatistics.h"
 
 //==============================================================================
 /*
 */
-class AnalysisReadout  : public juce::Component, public juce::Timer
+class AnalysisReadout  : public juce::Component, private RefreshScheduler::Client
 {
 public:
     AnalysisReadout(AnalysisModule& m, int featureIndex_)
     : analysisModule(m), featureIndex(featureIndex_)
     {
         featureName = analysisModule.getFeatureName(featureIndex);
-        startTimerHz(60);
     }
 
     ~AnalysisReadout() override
     {
     }
     
-    void timerCallback() override
+    /// Where the percentile and deviation come from; they aren't shown while this is null
+    void setStatistics(const AnalysisStatistics* s)
     {
+        statistics = s;
         repaint();
     }
+    
+    void refresh() override
+    {
+        AnalysisStatistics::Values stats;
+        hasStatistics = statistics != nullptr && statistics->getValues(analysisModule, featureIndex, stats);
+        
+        const float values[] = {
+            analysisModule.getMovingAverageValue(featureIndex),
+            analysisModule.getLifetimeAverageValue(featureIndex),
+            analysisModule.getLastValue(featureIndex),
+            stats.percentile,
+            stats.standardDeviation
+        };
+        
+        // The text shows 3 decimal places, which is finer than the bars can show at this width
+        bool changed = false;
+        for (int i = 0; i < c_numValues; i++)
+        {
+            if (!(std::abs(values[i] - lastPaintedValues[i]) < 0.0005f))
+            {
+                lastPaintedValues[i] = values[i];
+                changed = true;
+            }
+        }
+        
+        if (changed)
+            repaint();
+    }
 
     void paint (juce::Graphics& g) override
     {
@@ -52,6 +83,14 @@ public:
         rect = rect.getProportion<float>({0, 0.5f, lifetimeAverageValue, 0.5f});
         g.fillRect(rect);
 
+        float percentileValue = lastPaintedValues[3];
+        if (hasStatistics)
+        {
+            g.setColour(juce::Colours::orange);
+            float x = getWidth() * percentileValue;
+            g.drawLine(x, 0.0f, x, getHeight());
+        }
+        
         float lastValue = analysisModule.getLastValue(featureIndex);
         g.setColour(juce::Colours::yellowgreen);
         float x = getWidth() * lastValue;
@@ -69,8 +108,12 @@ public:
         }
 
         g.setColour (juce::Colours::white);
-        juce::String text = juce::String::formatted("exp avg = %.3f    life avg = %.3f    now = %.3f",
-                                                    movingAverageValue, lifetimeAverageValue, lastValue);
+        juce::String text = hasStatistics
+            ? juce::String::formatted("exp avg = %.3f    life avg = %.3f    p90 = %.3f    sd = %.3f    now = %.3f",
+                                      movingAverageValue, lifetimeAverageValue,
+                                      percentileValue, lastPaintedValues[4], lastValue)
+            : juce::String::formatted("exp avg = %.3f    life avg = %.3f    now = %.3f",
+                                      movingAverageValue, lifetimeAverageValue, lastValue);
         g.drawText (text, getLocalBounds(),
                     juce::Justification::centred, true);
         
@@ -85,5 +128,12 @@ private:
     const int featureIndex;
     juce::String featureName;
     
+    // Fed by the processor at a fixed rate in audio time; the readout only displays them
+    const AnalysisStatistics* statistics = nullptr;
+    bool hasStatistics = false;
+    
+    static constexpr int c_numValues = 5;
+    float lastPaintedValues[c_numValues] = { -1.0f, -1.0f, -1.0f, -1.0f, -1.0f };
+    
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AnalysisReadout)
 };
@@ -228,8 +228,6 @@ ParameterRoutingEditor::ItemDisplay::ItemDisplay(ParameterRouting& r)
 : routing(r)
 {
     refreshMappingCurve();
-    
-    startTimerHz(30);
 }
 
 ParameterRoutingEditor::ItemDisplay::~ItemDisplay()
@@ -264,6 +262,27 @@ void ParameterRoutingEditor::ItemDisplay::refreshMappingCurve()
     repaint();
 }
 
+juce::Point<float> ParameterRoutingEditor::ItemDisplay::getCurrentPoint() const
+{
+    auto bounds = getLocalBounds();
+    auto [sourceValue, destValue] = routing.getLastValues();
+    return {
+        sourceValue * (bounds.getWidth() - 1),
+        (1.0f - destValue) * (bounds.getHeight() - 1)
+    };
+}
+
+void ParameterRoutingEditor::ItemDisplay::refresh()
+{
+    // Only repaint once the dot has moved by at least half a pixel
+    auto point = getCurrentPoint();
+    if (!(point.getDistanceFrom(lastPaintedPoint) < 0.5f))
+    {
+        lastPaintedPoint = point;
+        repaint();
+    }
+}
+
 void ParameterRoutingEditor::ItemDisplay::paint(juce::Graphics& g)
 {
     g.fillAll(juce::Colours::black);
@@ -271,10 +290,7 @@ void ParameterRoutingEditor::ItemDisplay::paint(juce::Graphics& g)
     g.setColour(juce::Colours::yellow);
     g.strokePath(mappingCurve, juce::PathStrokeType(1.0f));
 
-    auto bounds = getLocalBounds();
-    auto [sourceValue, destValue] = routing.getLastValues();
-    float x = sourceValue * (bounds.getWidth() - 1);
-    float y = (1.0f - destValue) * (bounds.getHeight() - 1);
+    auto point = getCurrentPoint();
     g.setColour(juce::Colours::orange);
-    g.drawEllipse(x-3, y-3, 6, 6, 1);
+    g.drawEllipse(point.x-3, point.y-3, 6, 6, 1);
 }
@@ -12,6 +12,7 @@
 
 #include <JuceHeader.h>
 #include "../../atomicengine/ParameterRouting.h"
+#include "../Components/RefreshScheduler.h"
 
 //==============================================================================
 /*
@@ -38,7 +39,7 @@ private:
     juce::Slider inRangeSlider, outMinSlider, outMaxSlider, outSkewSlider;
     juce::Label labels[6];
 
-    class ItemDisplay : public juce::Component, public juce::Timer
+    class ItemDisplay : public juce::Component, private RefreshScheduler::Client
     {
     public:
         ItemDisplay(ParameterRouting& r);
@@ -49,12 +50,14 @@ private:
         
         void refreshMappingCurve();
         
-        void timerCallback() override { repaint(); }
+        void refresh() override;
         
     private:
         ParameterRouting& routing;
         
         juce::Path mappingCurve;
+        juce::Point<float> lastPaintedPoint { -1.0f, -1.0f };
+        juce::Point<float> getCurrentPoint() const;
                 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ItemDisplay);
     };
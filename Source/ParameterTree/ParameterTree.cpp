@@ -14,6 +14,7 @@
 #include "./ParameterTreeItems/RootItem.h"
 #include "./ParameterTreeItems/ProcessorItem.h"
 #include "./ParameterTreeItems/AnalysisModuleItem.h"
+#include "./ParameterTreeItems/ProfilerItem.h"
 
 //==============================================================================
 ParameterTree::ParameterTree()
@@ -37,3 +38,8 @@ void ParameterTree::add(AnalysisModule &am, const juce::String& name)
 {
     getRootItem()->addSubItem(new ParameterTreeItems::AnalysisModuleItem(am, name));
 }
+
+void ParameterTree::add(CpuProfiler &profiler, const juce::String& name)
+{
+    getRootItem()->addSubItem(new ParameterTreeItems::ProfilerItem(profiler, name));
+}
@@ -13,6 +13,7 @@
 #include <JuceHeader.h>
 #include "../../atomicengine/bsfx/Graph.h"
 #include "../../atomicengine/Analysis/AnalysisModule.h"
+#include "../CpuProfiler.h"
 
 //==============================================================================
 /*
@@ -25,6 +26,7 @@ public:
     
     void add(juce::AudioProcessor& proc, const juce::String& name = {});
     void add(AnalysisModule& am, const juce::String& name = {});
+    void add(CpuProfiler& profiler, const juce::String& name = {});
 
 private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterTree)
@@ -12,6 +12,7 @@
 #include "AnalysisModuleItem.h"
 #include "ParameterItem.h"
 #include "ProcessorItem.h"
+#include "../../PluginEditor.h"
 
 using namespace ParameterTreeItems;
 
@@ -41,6 +42,17 @@ void AnalysisModuleComponent::resized()
     }
 }
 
+void AnalysisModuleComponent::parentHierarchyChanged()
+{
+    // The statistics live on the processor, so they keep being fed while the tree is closed
+    const AnalysisStatistics* statistics = nullptr;
+    if (auto pluginEditor = findParentComponentOfClass<HydraAudioProcessorEditor>())
+        statistics = &pluginEditor->getAudioProcessor()->analysisStatistics;
+    
+    for (auto* r : readouts)
+        r->setStatistics(statistics);
+}
+
 //=============================================================================
 AnalysisModuleItem::AnalysisModuleItem(AnalysisModule& p, const juce::String& title_)
 : analysisModule(p), title(title_)
@@ -26,6 +26,7 @@ public:
     AnalysisModuleComponent(AnalysisModule& p, const juce::String& titleString);
     
     void resized() override;
+    void parentHierarchyChanged() override;
     
 private:
     AnalysisModule& analysisModule;
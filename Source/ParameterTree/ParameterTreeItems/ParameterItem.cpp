@@ -14,7 +14,6 @@
 #include "../../../atomicengine/ParameterRouting.h"
 #include "../../../atomicengine/bsfx/SetParameterValue.h"
 #include "../ParameterRoutingEditor.h"
-#include "../../MessageThreadUtils.h"
 #include "../../PluginEditor.h"
 
 using namespace ParameterTreeItems;
@@ -147,7 +146,7 @@ ParameterButtonsComponent::~ParameterButtonsComponent()
 
 void ParameterButtonsComponent::parameterValueChanged(int parameterIndex, float newValue)
 {
-    callSyncOrAsync([this] { updateFromParameter(); });
+    parameterUpdate.trigger();
 }
 
 void ParameterButtonsComponent::layoutChildren(juce::Rectangle<int> bounds)
@@ -212,9 +211,7 @@ ParameterTextDisplayComponent::~ParameterTextDisplayComponent()
 
 void ParameterTextDisplayComponent::parameterValueChanged(int parameterIndex, float newValue)
 {
-    callSyncOrAsync([this] {
-        label.setText(param->getCurrentValueAsText(), juce::dontSendNotification);
-    });
+    parameterUpdate.trigger();
 }
 
 void ParameterTextDisplayComponent::layoutChildren(juce::Rectangle<int> bounds)
@@ -383,7 +380,7 @@ void ParameterColourGroupComponent::changeListenerCallback(juce::ChangeBroadcast
 
 void ParameterColourGroupComponent::parameterValueChanged(int parameterIndex, float newValue)
 {
-    callSyncOrAsync([this] { updateFromParameters(); });
+    parameterUpdate.trigger();
 }
 
 void ParameterColourGroupComponent::updateFromParameters()
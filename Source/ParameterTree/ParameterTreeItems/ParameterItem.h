@@ -11,6 +11,7 @@
 #pragma once
 
 #include "../atomicengine/ParameterRouting.h"
+#include "../../MessageThreadUtils.h"
 
 class AtomicEngine;
 class ParameterRoutingEditor;
@@ -73,6 +74,7 @@ protected:
     
 private:
     juce::OwnedArray<juce::TextButton> buttons;
+    CoalescingDispatcher::Target parameterUpdate { [this] { updateFromParameter(); } };
     
     void updateFromParameter();
 };
@@ -106,6 +108,9 @@ protected:
     
 private:
     juce::Label label;
+    CoalescingDispatcher::Target parameterUpdate { [this] {
+        label.setText(param->getCurrentValueAsText(), juce::dontSendNotification);
+    } };
 };
 
 //==============================================================================
@@ -169,6 +174,7 @@ private:
     
     juce::Label nameLabel;
     std::unique_ptr<juce::ColourSelector> colourSelector;
+    CoalescingDispatcher::Target parameterUpdate { [this] { updateFromParameters(); } };
     
     void updateFromParameters();
 };
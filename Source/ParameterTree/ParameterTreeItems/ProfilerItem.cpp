@@ -0,0 +1,83 @@
+/*
+  ==============================================================================
+
+    ProfilerItem.cpp
+    Created: 17 Oct 2026 11:34:52am
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "ProfilerItem.h"
+
+using namespace ParameterTreeItems;
+
+ProfilerComponent::ProfilerComponent(CpuProfiler& p, const juce::String& titleString)
+: profiler(p)
+{
+    title.setText(titleString.isNotEmpty() ? titleString : "CPU profiler", juce::dontSendNotification);
+    addAndMakeVisible(title);
+    
+    enableButton.setToggleState(profiler.isEnabled(), juce::dontSendNotification);
+    enableButton.onClick = [this] { profiler.setEnabled(enableButton.getToggleState()); };
+    addAndMakeVisible(enableButton);
+    
+    resetButton.onClick = [this] { profiler.resetAll(); };
+    addAndMakeVisible(resetButton);
+}
+
+void ProfilerComponent::refresh()
+{
+    const double now = juce::Time::getMillisecondCounterHiRes();
+    if (now - lastRepaintTime < c_repaintIntervalMs)
+        return;
+    
+    lastRepaintTime = now;
+    repaint();
+}
+
+void ProfilerComponent::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().withTrimmedTop(c_titleHeight);
+    
+    g.setFont(juce::Font(juce::Font::getDefaultMonospacedFontName(), 11.0f, juce::Font::plain));
+    
+    for (int i=0; i<profiler.getNumSections(); i++)
+    {
+        const auto& section = profiler.getSection(i);
+        const auto stats = section.getStats();
+        
+        g.setColour(juce::Colours::white);
+        g.drawText(juce::String::formatted("%s: mean %.1f  p99 %.1f  max %.1f us",
+                                           section.name.toRawUTF8(),
+                                           stats.meanMicroseconds,
+                                           stats.p99Microseconds,
+                                           stats.maxMicroseconds),
+                   bounds.removeFromTop(c_sectionHeight), juce::Justification::centredLeft);
+    }
+}
+
+void ProfilerComponent::resized()
+{
+    auto titleBounds = getLocalBounds().removeFromTop(c_titleHeight);
+    resetButton.setBounds(titleBounds.removeFromRight(60));
+    enableButton.setBounds(titleBounds.removeFromRight(80));
+    title.setBounds(titleBounds);
+}
+
+//=============================================================================
+ProfilerItem::ProfilerItem(CpuProfiler& p, const juce::String& title_)
+: profiler(p), title(title_)
+{
+}
+
+int ProfilerItem::getItemHeight() const
+{
+    return ProfilerComponent::c_titleHeight
+        + profiler.getNumSections() * ProfilerComponent::c_sectionHeight;
+}
+
+std::unique_ptr<juce::Component> ProfilerItem::createItemComponent()
+{
+    return std::make_unique<ProfilerComponent>(profiler, title);
+}
@@ -0,0 +1,61 @@
+/*
+  ==============================================================================
+
+    ProfilerItem.h
+    Created: 17 Oct 2026 11:34:52am
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../CpuProfiler.h"
+#include "../../Components/RefreshScheduler.h"
+
+namespace ParameterTreeItems
+{
+
+//==============================================================================
+class ProfilerComponent : public juce::Component, private RefreshScheduler::Client
+{
+public:
+    static constexpr int c_titleHeight = 20;
+    static constexpr int c_sectionHeight = 16;
+    
+    ProfilerComponent(CpuProfiler& p, const juce::String& titleString);
+    
+    void refresh() override;
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    
+private:
+    // The stats are only readable if they don't change every frame
+    static constexpr double c_repaintIntervalMs = 250.0;
+    double lastRepaintTime = 0.0;
+    
+    CpuProfiler& profiler;
+
+    juce::Label title;
+    juce::ToggleButton enableButton { "Enabled" };
+    juce::TextButton resetButton { "Reset" };
+};
+
+//==============================================================================
+class ProfilerItem : public juce::TreeViewItem
+{
+public:
+    ProfilerItem(CpuProfiler& p, const juce::String& title_ = {});
+    
+    bool mightContainSubItems() override { return false; }
+    
+    int getItemHeight() const override;
+    std::unique_ptr<juce::Component> createItemComponent() override;
+        
+private:
+    CpuProfiler& profiler;
+    juce::String title;
+};
+
+//==============================================================================
+} // end namespace ParameterTreeItems
@@ -128,7 +128,9 @@ HydraAudioProcessorEditor::HydraAudioProcessorEditor (HydraAudioProcessor& p)
     visualiserFPS.setFont(10);
     visualiserFPS.setColour(juce::Label::textColourId, juce::Colours::yellow);
     visualiser.fpsCounter.onNewReading = [this](int fps, double cpu) {
-        visualiserFPS.setText(juce::String::formatted("%d FPS %.1f%% CPU", fps, cpu * 100.0),
+        visualiserFPS.setText(juce::String::formatted("%d FPS %.1f%% CPU Q%d/%d", fps, cpu * 100.0,
+                                                      visualiser.getQualityGovernor().getLevelIndex(),
+                                                      QualityGovernor::getNumLevels() - 1),
                               juce::dontSendNotification);
     };
     addAndMakeVisible(visualiserFPS);
@@ -136,6 +138,7 @@ HydraAudioProcessorEditor::HydraAudioProcessorEditor (HydraAudioProcessor& p)
     parameterTree.add(*audioProcessor.inputMeter, "inputMeter");
     parameterTree.add(*audioProcessor.outputMeter, "outputMeter");
     parameterTree.add(visualiser.processor, "visualiser");
+    parameterTree.add(audioProcessor.profiler, "CPU");
     
     auto tabColour = findColour(juce::ResizableWindow::backgroundColourId);
     devPanel.reset(new juce::TabbedComponent(juce::TabbedButtonBar::Orientation::TabsAtTop));
@@ -156,8 +159,6 @@ HydraAudioProcessorEditor::HydraAudioProcessorEditor (HydraAudioProcessor& p)
     addChildComponent(devPanel.get());
 #endif
     
-    startTimer(30);
-    
     setSize (980, 765);
 }
 
@@ -252,7 +253,7 @@ void HydraAudioProcessorEditor::resized()
 #endif
 }
 
-void HydraAudioProcessorEditor::timerCallback()
+void HydraAudioProcessorEditor::refresh()
 {
     float inputLevel = audioProcessor.inputMeter->getMeterValue(0);
     
@@ -15,6 +15,7 @@
 #include "Components/Knob.h"
 #include "Components/PresetMenu.h"
 #include "Components/PresetSelector.h"
+#include "Components/RefreshScheduler.h"
 #include "Components/VolumeMeter.h"
 #include "Visualiser/Visualiser.h"
 
@@ -27,7 +28,7 @@
 class HydraAudioProcessorEditor
 : public juce::Component
 , public AtomicEngine::Listener
-, public juce::Timer
+, private RefreshScheduler::Client
 {
 public:
     HydraAudioProcessorEditor (HydraAudioProcessor&);
@@ -36,7 +37,7 @@ public:
     //==============================================================================
     void paint (juce::Graphics&) override;
     void resized() override;
-    void timerCallback() override;
+    void refresh() override;
     
     //==============================================================================
     void engineMacroDisplayNameChanged(int macroIndex, juce::String name) override;
@@ -61,6 +62,9 @@ private:
 
     std::unique_ptr<juce::AlertWindow> saveNameDialog;
     
+    // Drives every live display in the editor from this window's vblank
+    RefreshScheduler::DisplayAttachment refreshAttachment { *this };
+    
 #if HYDRA_ENABLE_DEV_MODE
     static const int c_devPanelWidth = 400;
     std::unique_ptr<juce::TabbedComponent> devPanel;
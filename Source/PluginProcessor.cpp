@@ -27,19 +27,33 @@ HydraAudioProcessor::HydraAudioProcessor()
                        )
 #endif
 {
-    engine = new AtomicEngine;
+    processBlockSection = &profiler.addSection("processBlock");
+    
+    // Each node of the graph is timed as well, listed in chain order. The engine's effects and
+    // analysis modules are one block, as their processing is inside atomicengine.
+    auto& inputGainSection = profiler.addSection("inputGain");
+    auto& inputMeterSection = profiler.addSection("inputMeter");
+    auto& engineSection = profiler.addSection("engine");
+    auto& outputGainSection = profiler.addSection("outputGain");
+    auto& outputMeterSection = profiler.addSection("outputMeter");
+    
+    engine = new ProfiledProcessor<AtomicEngine>(profiler, engineSection);
     graph.addNodeToGraph(engine);
     
-    inputMeter = new bsfx::VolumeMeter;
+    inputMeter = new ProfiledProcessor<bsfx::VolumeMeter>(profiler, inputMeterSection);
     graph.addNodeToGraph(inputMeter);
     
-    outputMeter = new bsfx::VolumeMeter;
+    outputMeter = new ProfiledProcessor<bsfx::VolumeMeter>(profiler, outputMeterSection);
     graph.addNodeToGraph(outputMeter);
     
-    inputGain = new bsfx::GainDB(-12.0f, 12.0f, 0.0f);
+    analysisStatistics.addModule(*inputMeter);
+    analysisStatistics.addModule(*outputMeter);
+    analysisStatistics.start(*engine);
+    
+    inputGain = new ProfiledProcessor<bsfx::GainDB>(profiler, inputGainSection, -12.0f, 12.0f, 0.0f);
     graph.addNodeToGraph(inputGain);
     
-    outputGain = new bsfx::GainDB(-12.0f, 12.0f, 0.0f);
+    outputGain = new ProfiledProcessor<bsfx::GainDB>(profiler, outputGainSection, -12.0f, 12.0f, 0.0f);
     graph.addNodeToGraph(outputGain);
     
     graph.addChainToGraph(graph.getInputNodeID(),
@@ -190,6 +204,7 @@ void HydraAudioProcessor::changeProgramName (int index, const juce::String& newN
 void HydraAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
     juce::ScopedLock lock(criticalSection);
+    applyParameterChanges();
     graph.prepareToPlay(sampleRate, samplesPerBlock);
 }
 
@@ -223,9 +238,25 @@ bool HydraAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) co
 
 void HydraAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
-    juce::ScopedLock lock(criticalSection);
+    // Never wait on the lock here -- if prepareToPlay or reset is running on another thread, the
+    // graph is being rebuilt, so pass the input through for this block rather than blocking the
+    // callback. Dry signal is a much smaller glitch than a block of silence. Bypass, the gains and
+    // the mix all live in the graph, so they don't apply to these blocks either.
+    juce::ScopedTryLock lock(criticalSection);
+    if (!lock.isLocked())
+    {
+        if (getTotalNumInputChannels() == 1)
+            buffer.copyFrom(1, 0, buffer, 0, 0, buffer.getNumSamples());
+        
+        numPassThroughBlocks.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
+    HYDRA_PROFILE_SCOPE(profiler, *processBlockSection);
     juce::ScopedNoDenormals noDenormals;
+    lastProcessBlockTime.store(juce::Time::getMillisecondCounter(), std::memory_order_relaxed);
+    applyParameterChanges();
+    
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
     
@@ -241,6 +272,7 @@ void HydraAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::
     }
     
     graph.processBlock(buffer, midiMessages);
+    analysisStatistics.audioProcessed(buffer.getNumSamples(), getSampleRate());
 }
 
 //==============================================================================
@@ -303,7 +335,17 @@ void HydraAudioProcessor::setStateInformation (const void* data, int sizeInBytes
 //==============================================================================
 void HydraAudioProcessor::parameterValueChanged (int parameterIndex, float newValue)
 {
-    updatePluginParams();
+    // Can be called on the audio thread during automation, so just mark the parameter
+    // here; processBlock picks it up at the start of the next block
+    if (auto flag = getDirtyFlag(getParameters()[parameterIndex]))
+    {
+        dirtyParams.fetch_or(flag, std::memory_order_release);
+        
+        // In case audio isn't running. Host automation during playback is left to processBlock,
+        // so the audio thread doesn't post messages; this only posts if one isn't already pending.
+        if (isAudioIdle() || juce::MessageManager::existsAndIsCurrentThread())
+            triggerAsyncUpdate();
+    }
 }
 
 void HydraAudioProcessor::parameterGestureChanged (int parameterIndex, bool gestureIsStarting)
@@ -311,14 +353,69 @@ void HydraAudioProcessor::parameterGestureChanged (int parameterIndex, bool gest
     
 }
 //==============================================================================
-void HydraAudioProcessor::updatePluginParams()
-{
-    engine->setAnalysisFrozen(paramFreeze->get());
-    engine->setAtomicMode(paramAtomic->get());
-    bsfx::setParameterValue(engine->paramMix, paramMix->get());
-    bsfx::setParameterValue(graph.paramBypass, paramBypass->get());
-    bsfx::setParameterValue(inputGain->paramGain, juce::Decibels::gainToDecibels(paramInputGain->get()));
-    bsfx::setParameterValue(outputGain->paramGain, juce::Decibels::gainToDecibels(paramOutputGain->get()));
+uint32_t HydraAudioProcessor::getDirtyFlag(const juce::AudioProcessorParameter* param) const
+{
+    if (param == paramBypass)       return dirtyBypass;
+    if (param == paramAtomic)       return dirtyAtomic;
+    if (param == paramFreeze)       return dirtyFreeze;
+    if (param == paramInputGain)    return dirtyInputGain;
+    if (param == paramMix)          return dirtyMix;
+    if (param == paramOutputGain)   return dirtyOutputGain;
+    return 0;
+}
+
+void HydraAudioProcessor::updatePluginParams(uint32_t changed)
+{
+    if (changed & dirtyFreeze)
+        engine->setAnalysisFrozen(paramFreeze->get());
+    if (changed & dirtyAtomic)
+        engine->setAtomicMode(paramAtomic->get());
+    if (changed & dirtyMix)
+        bsfx::setParameterValue(engine->paramMix, paramMix->get());
+    if (changed & dirtyBypass)
+        bsfx::setParameterValue(graph.paramBypass, paramBypass->get());
+    if (changed & dirtyInputGain)
+        bsfx::setParameterValue(inputGain->paramGain, juce::Decibels::gainToDecibels(paramInputGain->get()));
+    if (changed & dirtyOutputGain)
+        bsfx::setParameterValue(outputGain->paramGain, juce::Decibels::gainToDecibels(paramOutputGain->get()));
+}
+
+void HydraAudioProcessor::applyParameterChanges()
+{
+    // Cheap when nothing has changed, which is most blocks
+    if (dirtyParams.load(std::memory_order_relaxed) == 0)
+        return;
+    
+    updatePluginParams(dirtyParams.exchange(0, std::memory_order_acquire));
+}
+
+bool HydraAudioProcessor::isAudioIdle() const
+{
+    return juce::Time::getMillisecondCounter() - lastProcessBlockTime.load(std::memory_order_relaxed) > c_audioIdleMs;
+}
+
+void HydraAudioProcessor::handleAsyncUpdate()
+{
+    if (dirtyParams.load(std::memory_order_relaxed) == 0)
+        return;
+    
+    if (isAudioIdle())
+    {
+        // If audio starts again while this holds the lock, that block passes the input through
+        juce::ScopedLock lock(criticalSection);
+        applyParameterChanges();
+    }
+    else
+    {
+        // processBlock should pick the changes up, but check again in case audio has just stopped
+        startTimer((int)c_audioIdleMs);
+    }
+}
+
+void HydraAudioProcessor::timerCallback()
+{
+    stopTimer();
+    handleAsyncUpdate();
 }
 
 //==============================================================================
@@ -15,11 +15,15 @@
 #include "../atomicengine/bsfx/GainDB.h"
 #include "../atomicengine/bsfx/VolumeMeter.h"
 #include "Visualiser/VisualiserProcessor.h"
+#include "CpuProfiler.h"
+#include "AnalysisStatistics.h"
 
 //==============================================================================
 class HydraAudioProcessor
 : public juce::AudioProcessor
 , public juce::AudioProcessorParameter::Listener
+, private juce::AsyncUpdater
+, private juce::Timer
 {
 public:
     //==============================================================================
@@ -82,17 +86,55 @@ public:
     
     VisualiserProcessor visualiserProcessor;
     
+    CpuProfiler profiler;
+    
+    /// Percentile and deviation of the analysis features, read by the editor's readouts
+    AnalysisStatistics analysisStatistics;
+    
     juce::Rectangle<int> editorWindow{980, 765};
+    
+    /// Blocks passed through unprocessed because the graph was being prepared or reset at the time
+    juce::int64 getNumPassThroughBlocks() const { return numPassThroughBlocks.load(std::memory_order_relaxed); }
 
 private:
+    // Held while the graph is prepared or reset; the audio thread only ever try-locks this
     juce::CriticalSection criticalSection;
     
+    CpuProfiler::Section* processBlockSection;
+    std::atomic<juce::int64> numPassThroughBlocks { 0 };
+    
     juce::AudioProcessorValueTreeState::ParameterLayout layout;
     std::unique_ptr<juce::AudioProcessorValueTreeState> parameters;
     void createParameters();
     void addParameters();
     
-    void updatePluginParams();
+    // One bit per plugin parameter (not macros, which the engine listens to itself). Set by
+    // parameterValueChanged, which may be called on any thread, and applied by processBlock.
+    enum DirtyParam : uint32_t
+    {
+        dirtyBypass     = 1 << 0,
+        dirtyAtomic     = 1 << 1,
+        dirtyFreeze     = 1 << 2,
+        dirtyInputGain  = 1 << 3,
+        dirtyMix        = 1 << 4,
+        dirtyOutputGain = 1 << 5,
+        dirtyAll        = (1 << 6) - 1
+    };
+    
+    std::atomic<uint32_t> dirtyParams { 0 };
+    
+    uint32_t getDirtyFlag(const juce::AudioProcessorParameter* param) const;
+    void updatePluginParams(uint32_t changed = dirtyAll);
+    void applyParameterChanges();
+    
+    // When the host isn't calling processBlock (e.g. stopped, or the track is disabled), changes
+    // are applied on the message thread instead, so that the engine doesn't lag behind the UI
+    static constexpr juce::uint32 c_audioIdleMs = 500;
+    std::atomic<juce::uint32> lastProcessBlockTime { 0 };
+    bool isAudioIdle() const;
+    
+    void handleAsyncUpdate() override;
+    void timerCallback() override;
     
     template<typename T>
     void addParam(T* param)
@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    StreamingStatistics.h
+    Created: 17 Oct 2026 7:02:18pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+//==============================================================================
+/// Running mean and variance (Welford's method). Constant time and memory per value, and
+/// doesn't lose precision over long runs the way summing squares does.
+class RunningVariance
+{
+public:
+    void addValue(double x) noexcept
+    {
+        count++;
+        const double delta = x - mean;
+        mean += delta / (double)count;
+        m2 += delta * (x - mean);
+    }
+
+    long long getCount() const noexcept { return count; }
+    double getMean() const noexcept { return mean; }
+
+    /// Sample variance; 0 until there are two values
+    double getVariance() const noexcept { return count > 1 ? m2 / (double)(count - 1) : 0.0; }
+    double getStandardDeviation() const noexcept { return std::sqrt(getVariance()); }
+
+    void reset() noexcept { *this = {}; }
+
+private:
+    long long count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+};
+
+//==============================================================================
+/// Estimates a single quantile of a stream of values with the P² algorithm (Jain & Chlamtac, 1985).
+/// Keeps five markers whose heights are adjusted with piecewise-parabolic interpolation as values
+/// arrive, so memory and time per value are constant however long the stream is.
+class P2Quantile
+{
+public:
+    /// quantile is in (0, 1), e.g. 0.9 for the 90th percentile
+    explicit P2Quantile(double quantile = 0.5) noexcept : p(quantile) { reset(); }
+
+    void addValue(double x) noexcept
+    {
+        if (count < 5)
+        {
+            heights[count++] = x;
+            if (count == 5)
+                insertionSort(heights, 5);
+            return;
+        }
+
+        count++;
+
+        // Find the cell the value falls into, extending the extremes if needed
+        int k;
+        if (x < heights[0])
+        {
+            heights[0] = x;
+            k = 0;
+        }
+        else if (x >= heights[4])
+        {
+            heights[4] = x;
+            k = 3;
+        }
+        else
+        {
+            k = 0;
+            while (x >= heights[k + 1])
+                k++;
+        }
+
+        for (int i = k + 1; i < 5; i++)
+            positions[i]++;
+
+        for (int i = 0; i < 5; i++)
+            desiredPositions[i] += increments[i];
+
+        // Move the middle markers towards their desired positions
+        for (int i = 1; i < 4; i++)
+        {
+            const double d = desiredPositions[i] - positions[i];
+            if ((d >= 1.0 && positions[i + 1] - positions[i] > 1.0)
+                || (d <= -1.0 && positions[i - 1] - positions[i] < -1.0))
+            {
+                const double sign = d > 0.0 ? 1.0 : -1.0;
+                const double candidate = parabolic(i, sign);
+
+                if (heights[i - 1] < candidate && candidate < heights[i + 1])
+                    heights[i] = candidate;
+                else
+                    heights[i] = linear(i, (int)sign);
+
+                positions[i] += sign;
+            }
+        }
+    }
+
+    /// The current estimate; exact while there are five values or fewer
+    double getEstimate() const noexcept
+    {
+        if (count >= 5)
+            return heights[2];
+
+        if (count == 0)
+            return 0.0;
+
+        double sorted[5];
+        std::copy(heights, heights + count, sorted);
+        insertionSort(sorted, count);
+        return sorted[std::min(count - 1, (int)std::lround(p * (count - 1)))];
+    }
+
+    double getQuantile() const noexcept { return p; }
+
+    void reset() noexcept
+    {
+        count = 0;
+
+        for (int i = 0; i < 5; i++)
+        {
+            heights[i] = 0.0;
+            positions[i] = (double)(i + 1);
+        }
+
+        desiredPositions[0] = 1.0;
+        desiredPositions[1] = 1.0 + 2.0 * p;
+        desiredPositions[2] = 1.0 + 4.0 * p;
+        desiredPositions[3] = 3.0 + 2.0 * p;
+        desiredPositions[4] = 5.0;
+
+        increments[0] = 0.0;
+        increments[1] = p / 2.0;
+        increments[2] = p;
+        increments[3] = (1.0 + p) / 2.0;
+        increments[4] = 1.0;
+    }
+
+private:
+    double p;
+    int count = 0;
+
+    double heights[5];
+    double positions[5];
+    double desiredPositions[5];
+    double increments[5];
+
+    double parabolic(int i, double d) const noexcept
+    {
+        return heights[i] + d / (positions[i + 1] - positions[i - 1])
+            * ((positions[i] - positions[i - 1] + d) * (heights[i + 1] - heights[i]) / (positions[i + 1] - positions[i])
+               + (positions[i + 1] - positions[i] - d) * (heights[i] - heights[i - 1]) / (positions[i] - positions[i - 1]));
+    }
+
+    static void insertionSort(double* values, int n) noexcept
+    {
+        for (int i = 1; i < n; i++)
+            for (int j = i; j > 0 && values[j] < values[j - 1]; j--)
+                std::swap(values[j], values[j - 1]);
+    }
+
+    double linear(int i, int d) const noexcept
+    {
+        return heights[i] + d * (heights[i + d] - heights[i]) / (positions[i + d] - positions[i]);
+    }
+};
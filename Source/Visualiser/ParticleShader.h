@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "ParticleStore.h"
+
 class ParticleShader : public bsgl::ShaderProgram
 {
 public:
@@ -39,12 +41,7 @@ public:
     };
 
     // All information about particles which is passed to the GPU
-    struct Instance
-    {
-        glm::vec3 in_particlePosition;
-        glm::vec4 in_colour;
-        float in_particleSize;
-    };
+    using Instance = ParticleInstance;
 
     //=========================================================================
     class Buffer : public bsgl::BufferObject<Vertex, Instance>
@@ -65,9 +62,8 @@ public:
         juce::Array<AttributeInfo> getInstanceAttributes() override
         {
             return {
-                BSGL_INSTANCE_ATTRIBUTE_INFO(in_particlePosition),
+                BSGL_INSTANCE_ATTRIBUTE_INFO(in_particlePositionAndSize),
                 BSGL_INSTANCE_ATTRIBUTE_INFO(in_colour),
-                BSGL_INSTANCE_ATTRIBUTE_INFO(in_particleSize),
             };
         }
     };
@@ -0,0 +1,287 @@
+/*
+  ==============================================================================
+
+    ParticleSimd.h
+    Created: 17 Oct 2026 1:12:37pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Pick the widest instruction set that every target of the plugin is guaranteed to have.
+// SSE2 is baseline on x86-64, and NEON is baseline on arm64. Anything else uses the scalar fallback.
+#if ! defined(HYDRA_PARTICLE_SIMD_SCALAR)
+ #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define HYDRA_PARTICLE_SIMD_SSE2 1
+  #include <emmintrin.h>
+ #elif defined(__aarch64__) || defined(_M_ARM64)
+  #define HYDRA_PARTICLE_SIMD_NEON 1
+  #include <arm_neon.h>
+ #endif
+#endif
+
+namespace ParticleSimd
+{
+
+//==============================================================================
+#if HYDRA_PARTICLE_SIMD_SSE2
+
+struct Mask4
+{
+    __m128 v;
+
+    friend Mask4 operator&(Mask4 a, Mask4 b) { return { _mm_and_ps(a.v, b.v) }; }
+};
+
+struct Float4
+{
+    __m128 v;
+
+    static Float4 load(const float* p)      { return { _mm_loadu_ps(p) }; }
+    static Float4 broadcast(float x)        { return { _mm_set1_ps(x) }; }
+    void store(float* p) const              { _mm_storeu_ps(p, v); }
+
+    friend Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.v, b.v) }; }
+    friend Float4 operator-(Float4 a, Float4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+    friend Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+    friend Float4 operator/(Float4 a, Float4 b) { return { _mm_div_ps(a.v, b.v) }; }
+
+    friend Float4 sqrt(Float4 a)                { return { _mm_sqrt_ps(a.v) }; }
+    friend Float4 min(Float4 a, Float4 b)       { return { _mm_min_ps(a.v, b.v) }; }
+    friend Float4 max(Float4 a, Float4 b)       { return { _mm_max_ps(a.v, b.v) }; }
+
+    friend Mask4 operator<(Float4 a, Float4 b)  { return { _mm_cmplt_ps(a.v, b.v) }; }
+    friend Mask4 operator>(Float4 a, Float4 b)  { return { _mm_cmpgt_ps(a.v, b.v) }; }
+
+    /// Lanes where mask is set take a, others take b
+    friend Float4 select(Mask4 mask, Float4 a, Float4 b)
+    {
+        return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) };
+    }
+
+    friend void transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+    {
+        _MM_TRANSPOSE4_PS(a.v, b.v, c.v, d.v);
+    }
+};
+
+struct UInt4
+{
+    __m128i v;
+
+    static UInt4 broadcast(uint32_t x)      { return { _mm_set1_epi32((int)x) }; }
+    static UInt4 sequence(uint32_t first)   { return { _mm_setr_epi32((int)first, (int)(first + 1), (int)(first + 2), (int)(first + 3)) }; }
+
+    friend UInt4 operator+(UInt4 a, UInt4 b) { return { _mm_add_epi32(a.v, b.v) }; }
+    friend UInt4 operator^(UInt4 a, UInt4 b) { return { _mm_xor_si128(a.v, b.v) }; }
+
+    /// Low 32 bits of each lane's product. SSE2 has no 32-bit multiply, so multiply the
+    /// even and odd lanes as 64-bit products and shuffle the low halves back together.
+    friend UInt4 operator*(UInt4 a, UInt4 b)
+    {
+        const __m128i even = _mm_mul_epu32(a.v, b.v);
+        const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a.v, 4), _mm_srli_si128(b.v, 4));
+        return { _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                    _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))) };
+    }
+
+    template<int shift>
+    UInt4 shiftRight() const { return { _mm_srli_epi32(v, shift) }; }
+
+    /// Top 24 bits of each lane as a float in [0, 1)
+    Float4 toUnitFloat() const
+    {
+        return { _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, 8)), _mm_set1_ps(1.0f / 16777216.0f)) };
+    }
+};
+
+//==============================================================================
+#elif HYDRA_PARTICLE_SIMD_NEON
+
+struct Mask4
+{
+    uint32x4_t v;
+
+    friend Mask4 operator&(Mask4 a, Mask4 b) { return { vandq_u32(a.v, b.v) }; }
+};
+
+struct Float4
+{
+    float32x4_t v;
+
+    static Float4 load(const float* p)      { return { vld1q_f32(p) }; }
+    static Float4 broadcast(float x)        { return { vdupq_n_f32(x) }; }
+    void store(float* p) const              { vst1q_f32(p, v); }
+
+    friend Float4 operator+(Float4 a, Float4 b) { return { vaddq_f32(a.v, b.v) }; }
+    friend Float4 operator-(Float4 a, Float4 b) { return { vsubq_f32(a.v, b.v) }; }
+    friend Float4 operator*(Float4 a, Float4 b) { return { vmulq_f32(a.v, b.v) }; }
+    friend Float4 operator/(Float4 a, Float4 b) { return { vdivq_f32(a.v, b.v) }; }
+
+    friend Float4 sqrt(Float4 a)                { return { vsqrtq_f32(a.v) }; }
+    friend Float4 min(Float4 a, Float4 b)       { return { vminq_f32(a.v, b.v) }; }
+    friend Float4 max(Float4 a, Float4 b)       { return { vmaxq_f32(a.v, b.v) }; }
+
+    friend Mask4 operator<(Float4 a, Float4 b)  { return { vcltq_f32(a.v, b.v) }; }
+    friend Mask4 operator>(Float4 a, Float4 b)  { return { vcgtq_f32(a.v, b.v) }; }
+
+    /// Lanes where mask is set take a, others take b
+    friend Float4 select(Mask4 mask, Float4 a, Float4 b) { return { vbslq_f32(mask.v, a.v, b.v) }; }
+
+    friend void transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+    {
+        const float32x4x2_t ab = vtrnq_f32(a.v, b.v);
+        const float32x4x2_t cd = vtrnq_f32(c.v, d.v);
+        a.v = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+        b.v = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+        c.v = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+        d.v = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+    }
+};
+
+struct UInt4
+{
+    uint32x4_t v;
+
+    static UInt4 broadcast(uint32_t x)      { return { vdupq_n_u32(x) }; }
+    static UInt4 sequence(uint32_t first)
+    {
+        const uint32_t lanes[4] = { first, first + 1, first + 2, first + 3 };
+        return { vld1q_u32(lanes) };
+    }
+
+    friend UInt4 operator+(UInt4 a, UInt4 b) { return { vaddq_u32(a.v, b.v) }; }
+    friend UInt4 operator^(UInt4 a, UInt4 b) { return { veorq_u32(a.v, b.v) }; }
+    friend UInt4 operator*(UInt4 a, UInt4 b) { return { vmulq_u32(a.v, b.v) }; }
+
+    template<int shift>
+    UInt4 shiftRight() const { return { vshrq_n_u32(v, shift) }; }
+
+    /// Top 24 bits of each lane as a float in [0, 1)
+    Float4 toUnitFloat() const
+    {
+        return { vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(v, 8)), 1.0f / 16777216.0f) };
+    }
+};
+
+//==============================================================================
+#else
+
+struct Mask4
+{
+    bool v[4];
+
+    friend Mask4 operator&(Mask4 a, Mask4 b) { return { { a.v[0] && b.v[0], a.v[1] && b.v[1], a.v[2] && b.v[2], a.v[3] && b.v[3] } }; }
+};
+
+struct Float4
+{
+    float v[4];
+
+    static Float4 load(const float* p)      { return { { p[0], p[1], p[2], p[3] } }; }
+    static Float4 broadcast(float x)        { return { { x, x, x, x } }; }
+    void store(float* p) const              { for (int i = 0; i < 4; i++) p[i] = v[i]; }
+
+    template<typename Op>
+    static Float4 apply(Float4 a, Float4 b, Op op) { return { { op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3]) } }; }
+
+    template<typename Op>
+    static Mask4 compare(Float4 a, Float4 b, Op op) { return { { op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3]) } }; }
+
+    friend Float4 operator+(Float4 a, Float4 b) { return apply(a, b, [](float x, float y) { return x + y; }); }
+    friend Float4 operator-(Float4 a, Float4 b) { return apply(a, b, [](float x, float y) { return x - y; }); }
+    friend Float4 operator*(Float4 a, Float4 b) { return apply(a, b, [](float x, float y) { return x * y; }); }
+    friend Float4 operator/(Float4 a, Float4 b) { return apply(a, b, [](float x, float y) { return x / y; }); }
+
+    friend Float4 sqrt(Float4 a)                { return { { std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3]) } }; }
+    friend Float4 min(Float4 a, Float4 b)       { return apply(a, b, [](float x, float y) { return x < y ? x : y; }); }
+    friend Float4 max(Float4 a, Float4 b)       { return apply(a, b, [](float x, float y) { return x > y ? x : y; }); }
+
+    friend Mask4 operator<(Float4 a, Float4 b)  { return compare(a, b, [](float x, float y) { return x < y; }); }
+    friend Mask4 operator>(Float4 a, Float4 b)  { return compare(a, b, [](float x, float y) { return x > y; }); }
+
+    /// Lanes where mask is set take a, others take b
+    friend Float4 select(Mask4 mask, Float4 a, Float4 b)
+    {
+        return { { mask.v[0] ? a.v[0] : b.v[0], mask.v[1] ? a.v[1] : b.v[1], mask.v[2] ? a.v[2] : b.v[2], mask.v[3] ? a.v[3] : b.v[3] } };
+    }
+
+    friend void transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+    {
+        Float4* rows[4] = { &a, &b, &c, &d };
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = i + 1; j < 4; j++)
+            {
+                const float t = rows[i]->v[j];
+                rows[i]->v[j] = rows[j]->v[i];
+                rows[j]->v[i] = t;
+            }
+        }
+    }
+};
+
+struct UInt4
+{
+    uint32_t v[4];
+
+    static UInt4 broadcast(uint32_t x)      { return { { x, x, x, x } }; }
+    static UInt4 sequence(uint32_t first)   { return { { first, first + 1, first + 2, first + 3 } }; }
+
+    friend UInt4 operator+(UInt4 a, UInt4 b) { return { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; }
+    friend UInt4 operator^(UInt4 a, UInt4 b) { return { { a.v[0] ^ b.v[0], a.v[1] ^ b.v[1], a.v[2] ^ b.v[2], a.v[3] ^ b.v[3] } }; }
+    friend UInt4 operator*(UInt4 a, UInt4 b) { return { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } }; }
+
+    template<int shift>
+    UInt4 shiftRight() const { return { { v[0] >> shift, v[1] >> shift, v[2] >> shift, v[3] >> shift } }; }
+
+    /// Top 24 bits of each lane as a float in [0, 1)
+    Float4 toUnitFloat() const
+    {
+        return { { (float)(v[0] >> 8) / 16777216.0f, (float)(v[1] >> 8) / 16777216.0f,
+                   (float)(v[2] >> 8) / 16777216.0f, (float)(v[3] >> 8) / 16777216.0f } };
+    }
+};
+
+#endif
+
+//==============================================================================
+/// Integer hash (lowbias32), used as a counter-based random number generator: hashing
+/// (seed, frame, particle, component) gives the same value whatever order particles are updated in.
+inline uint32_t hash(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+inline UInt4 hash(UInt4 x)
+{
+    x = x ^ x.shiftRight<16>();
+    x = x * UInt4::broadcast(0x7feb352du);
+    x = x ^ x.shiftRight<15>();
+    x = x * UInt4::broadcast(0x846ca68bu);
+    x = x ^ x.shiftRight<16>();
+    return x;
+}
+
+/// Stores 8 vectors so that lane i of each ends up as the 8 consecutive floats at dest + 8 * i
+inline void storeInterleaved8(float* dest, Float4 c0, Float4 c1, Float4 c2, Float4 c3,
+                                           Float4 c4, Float4 c5, Float4 c6, Float4 c7)
+{
+    transpose(c0, c1, c2, c3);
+    transpose(c4, c5, c6, c7);
+    c0.store(dest + 0);  c4.store(dest + 4);
+    c1.store(dest + 8);  c5.store(dest + 12);
+    c2.store(dest + 16); c6.store(dest + 20);
+    c3.store(dest + 24); c7.store(dest + 28);
+}
+
+} // namespace ParticleSimd
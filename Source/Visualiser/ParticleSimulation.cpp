@@ -0,0 +1,189 @@
+/*
+  ==============================================================================
+
+    ParticleSimulation.cpp
+    Created: 17 Oct 2026 3:48:21pm
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "ParticleSimulation.h"
+#include "ParticleSimd.h"
+
+//==============================================================================
+ParticleSimulation::ParticleSimulation(VisualiserProcessor& p, int numWorkers, juce::int64 seed)
+: processor(p)
+, rng(seed)
+, particleUpdatePool(numWorkers)
+{
+}
+
+//==============================================================================
+ParticleSimulation::Camera ParticleSimulation::Camera::fromParameters(const VisualiserProcessor& processor, float aspectRatio)
+{
+    Camera camera;
+    camera.projMatrix = glm::perspective(glm::radians(processor.paramCameraFOV->get()),
+                                         aspectRatio,
+                                         0.1f,
+                                         50.0f);
+    camera.invProjMatrix = glm::inverse(camera.projMatrix);
+    camera.position = glm::vec3 { 0.0f, processor.paramCameraYPos->get(), processor.paramCameraZPos->get() };
+    camera.viewMatrix = glm::lookAt(camera.position,
+                                    glm::vec3 { 0.0f, 0.0f, 0.0f },
+                                    glm::vec3 { 0.0f, 1.0f, 0.0f });
+    camera.invViewMatrix = glm::inverse(camera.viewMatrix);
+    return camera;
+}
+
+glm::vec3 ParticleSimulation::Camera::getRayThroughScreenPoint(glm::vec2 screenPos) const
+{
+    glm::vec4 worldPos = invViewMatrix * invProjMatrix * glm::vec4(screenPos, 0.5f, 1.0f);
+    worldPos /= worldPos.w;
+    return glm::normalize(glm::vec3 { worldPos } - position);
+}
+
+//==============================================================================
+void ParticleSimulation::initParticles(bool clearExisting)
+{
+    if (clearExisting)
+    {
+        particles.clear();
+        jitterSeed = (juce::uint32)rng.nextInt();
+    }
+
+    int numInstances = processor.paramNumParticles->get();
+
+    if (numInstances < particles.size())
+    {
+        particles.truncate(numInstances);
+    }
+    else
+    {
+        const float baseRadius = processor.paramBaseRadius->get();
+        const float baseSize = processor.paramParticleSize->get();
+        const float sizeRange = processor.paramParticleSizeRandomness->get();
+
+        while (particles.size() < numInstances)
+        {
+            // Generate point inside unit sphere, by rejection sampling
+            glm::vec3 pos;
+            do {
+                pos = {
+                    (rng.nextFloat() - 0.5f) * 2.0f,
+                    (rng.nextFloat() - 0.5f) * 2.0f,
+                    (rng.nextFloat() - 0.5f) * 2.0f
+                };
+            } while (glm::dot(pos, pos) > 1.0f);
+
+            // Normalise onto the sphere
+            pos = glm::normalize(pos);
+
+            // Colour is worked out by the first update, so only position and size are needed here
+            const float size = baseSize * randomFloat(1.0f - sizeRange, 1.0f + sizeRange);
+            particles.add(pos * baseRadius, size, pos, randomFloat(0.0f, 1.0f));
+        }
+    }
+}
+
+int ParticleSimulation::getNumParticles() const
+{
+    if (particles.size() == 0)
+        return 0;
+    
+    return juce::jmax(1, juce::roundToInt((float)particles.size() * particleFraction));
+}
+
+//==============================================================================
+template<typename T>
+T calculateExponentialFactor(T timeMS, double sampleRate)
+{
+    static constexpr T log2 = static_cast<T>(0.6931471805599453);
+
+    if (timeMS > 0.001)
+        return static_cast<T>(exp(-log2 / (timeMS / 1000.0 * sampleRate)));
+    else
+        return static_cast<T>(0.0);
+}
+
+//==============================================================================
+glm::mat4 ParticleSimulation::getModelMatrix(float angle)
+{
+    return glm::rotate(glm::mat4(1.0f), angle, glm::vec3 { 0.0f, 1.0f, 0.0f });
+}
+
+void ParticleSimulation::advanceRotation(float deltaTime)
+{
+    float rotationStep = glm::radians(processor.paramRotationSpeed->get()) * (float)deltaTime;
+    rotationAngle = fmod(rotationAngle + rotationStep, juce::MathConstants<float>::twoPi);
+    modelMatrix = getModelMatrix(rotationAngle);
+    invModelMatrix = getModelMatrix(-rotationAngle);
+}
+
+//==============================================================================
+void ParticleSimulation::step(const StepInput& input, ParticleInstance* instances)
+{
+    const float deltaTime = input.deltaTime;
+
+    if (input.advanceRotation)
+        advanceRotation(deltaTime);
+
+    ParticleUpdateUniforms uniforms;
+    uniforms.deltaTime = deltaTime;
+    uniforms.activationValue = input.activationValue;
+
+    // The particles live in model space, so the camera and mouse ray are rotated into it
+    uniforms.mouseEffectRadius = processor.paramMouseEffectRadius->get();
+    uniforms.mouseRepulsionForce = processor.paramMouseRepulsion->get();
+    uniforms.mouseSnapMultiplierStep = deltaTime / processor.paramMouseEffectDuration->get();
+    uniforms.useMouse = input.useMouse && uniforms.mouseEffectRadius > 0.0f && !juce::approximatelyEqual(input.mouseSpeed, 0.0f);
+    uniforms.cameraWorldPos = invModelMatrix * glm::vec4 { camera.position, 1.0f };
+    uniforms.mouseRay = glm::mat3(invModelMatrix) * input.mouseRay;
+    uniforms.mouseSpeed = input.mouseSpeed;
+
+    uniforms.escapeSpeedMultiplier = processor.paramEscapeSpeedMultiplier->get();
+    uniforms.escapeSnapMultiplierStep = deltaTime / juce::jmax(processor.paramEscapeDuration->get(), 1.0e-3f);
+
+    uniforms.snapAmount = processor.paramMovementStyle->get();
+    uniforms.snapFactor = calculateExponentialFactor(processor.paramSnappySpeed->get(), 1.0 / deltaTime);
+
+    uniforms.velDampingFactor = pow(1.0f - processor.paramDampingFactor->get(), deltaTime);
+    uniforms.accelerationFactor = processor.paramForceScale->get();
+    uniforms.jitterFactor = processor.paramJitterAmount->get();
+    uniforms.baseRadius = processor.paramBaseRadius->get();
+    uniforms.bandSize = glm::vec2(processor.paramHorizontalBandSize->get(),
+                                  processor.paramVerticalBandSize->get());
+    uniforms.bandSmoothness = processor.paramBandSmoothness->get();
+
+    for (int i=0; i<Region::c_numRegions; i++)
+    {
+        uniforms.regionColours[i] = glm::mix(glm::vec4(1.0f), processor.regionColours[i]->getVec4(), input.activationValue);
+        uniforms.regionTargetRadii[i] = uniforms.baseRadius * glm::mix(1.0f, 1.0f + processor.paramRegionRadiusMod[i]->get(), input.activationValue);
+    }
+
+    uniforms.mvpMatrix = camera.projMatrix * camera.viewMatrix * modelMatrix;
+
+    uniforms.randomSeed = ParticleSimd::hash(jitterSeed + 0x9e3779b9u * frameCounter++);
+
+    // Each particle only depends on the uniforms and its own state, and jitter is a function of
+    // the particle index, so the chunks can run in any order on any thread with the same result
+    const int numParticles = getNumParticles();
+    const int numChunks = (numParticles + c_particlesPerChunk - 1) / c_particlesPerChunk;
+    static_assert(c_particlesPerChunk % ParticleStore::c_laneCount == 0);
+
+    const auto callingThread = juce::Thread::getCurrentThreadId();
+    std::atomic<juce::int64> workerTicks { 0 };
+
+    particleUpdatePool.run(numChunks, [&](int chunk) {
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        const int begin = chunk * c_particlesPerChunk;
+        particles.update(uniforms, begin, juce::jmin(begin + c_particlesPerChunk, numParticles), instances);
+
+        if (juce::Thread::getCurrentThreadId() != callingThread)
+            workerTicks += juce::Time::getHighResolutionTicks() - startTicks;
+    });
+
+    lastStepWorkerTicks = workerTicks;
+}
@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    ParticleSimulation.h
+    Created: 17 Oct 2026 3:48:21pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <glm/glm.hpp>
+
+#include "VisualiserProcessor.h"
+#include "ParticleStore.h"
+#include "WorkStealingPool.h"
+
+//==============================================================================
+/// The visualiser's particle physics, with no dependency on a component or an OpenGL context.
+/// Not thread safe: the owner must serialise calls (the visualiser does this with its critical section).
+class ParticleSimulation
+{
+public:
+    using Region = VisualiserProcessor::Region;
+
+    /// The seed makes the initial particle layout and the jitter reproducible
+    ParticleSimulation(VisualiserProcessor& processor,
+                       int numWorkers = WorkStealingPool::getDefaultNumWorkers(),
+                       juce::int64 seed = juce::Random::getSystemRandom().nextInt64());
+
+    //==========================================================================
+    struct Camera
+    {
+        glm::vec3 position { 0.0f };
+        glm::mat4 viewMatrix { 1.0f }, invViewMatrix { 1.0f };
+        glm::mat4 projMatrix { 1.0f }, invProjMatrix { 1.0f };
+
+        /// Camera as set up by the processor's camera parameters, for a viewport of the given aspect ratio
+        static Camera fromParameters(const VisualiserProcessor& processor, float aspectRatio);
+
+        /// Normalised world space direction from the camera through a point in [-1, 1] screen space
+        glm::vec3 getRayThroughScreenPoint(glm::vec2 screenPos) const;
+    };
+
+    void setCamera(const Camera& newCamera) { camera = newCamera; }
+    const Camera& getCamera() const { return camera; }
+
+    //==========================================================================
+    /// Everything that drives a single step, other than the processor's parameters
+    struct StepInput
+    {
+        float deltaTime = 0.0f;
+        float activationValue = 0.0f;
+
+        /// World space mouse ray from the camera, and the speed of the mouse across the screen.
+        /// Leave useMouse false when the mouse is outside the visualiser.
+        bool useMouse = false;
+        glm::vec3 mouseRay { 0.0f };
+        float mouseSpeed = 0.0f;
+
+        /// Clear if the rotation has already been advanced over deltaTime with advanceRotation()
+        bool advanceRotation = true;
+    };
+
+    /// Adds or removes particles to match the processor's particle count.
+    /// If clearExisting is set, every particle is regenerated and the jitter is reseeded.
+    void initParticles(bool clearExisting);
+
+    /// Only this fraction of the particles is simulated and drawn. The rest are kept as they are,
+    /// so that raising it again brings back the same particles.
+    void setParticleFraction(float newFraction) { particleFraction = juce::jlimit(0.0f, 1.0f, newFraction); }
+
+    /// Number of particles currently being simulated
+    int getNumParticles() const;
+
+    /// Advances the simulation and writes getNumParticles() instances
+    void step(const StepInput& input, ParticleInstance* instances);
+
+    /// CPU time spent on the pool's worker threads during the last step, which doesn't show up
+    /// in the calling thread's own timing
+    juce::int64 getLastStepWorkerTicks() const { return lastStepWorkerTicks; }
+
+    /// Turns the model by the rotation speed parameter. The particles live in model space, so this
+    /// changes nothing but the model matrix, and is cheap enough to call without a step.
+    void advanceRotation(float deltaTime);
+
+    float getRotationAngle() const { return rotationAngle; }
+    const glm::mat4& getModelMatrix() const { return modelMatrix; }
+
+    static glm::mat4 getModelMatrix(float rotationAngle);
+
+private:
+    VisualiserProcessor& processor;
+
+    juce::Random rng;
+
+    inline float randomFloat(float minValue, float maxValue)
+    {
+        return juce::jmap(rng.nextFloat(), minValue, maxValue);
+    }
+
+    //==========================================================================
+    ParticleStore particles;
+
+    // Particles are updated in chunks of this size, spread across the pool
+    static constexpr int c_particlesPerChunk = 1024;
+    WorkStealingPool particleUpdatePool;
+
+    juce::uint32 jitterSeed = 0;
+    juce::uint32 frameCounter = 0;
+    float particleFraction = 1.0f;
+    juce::int64 lastStepWorkerTicks = 0;
+
+    //==========================================================================
+    Camera camera;
+    float rotationAngle = 0.0f;
+    glm::mat4 modelMatrix { 1.0f }, invModelMatrix { 1.0f };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParticleSimulation)
+};
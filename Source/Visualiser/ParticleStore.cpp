@@ -0,0 +1,307 @@
+/*
+  ==============================================================================
+
+    ParticleStore.cpp
+    Created: 17 Oct 2026 1:40:18pm
+
+  ==============================================================================
+*/
+
+#include "ParticleStore.h"
+#include "ParticleSimd.h"
+
+using namespace ParticleSimd;
+
+//==============================================================================
+void ParticleStore::clear()
+{
+    for (auto& field : fields)
+        field.clearQuick();
+
+    numParticles = 0;
+}
+
+void ParticleStore::truncate(int newSize)
+{
+    jassert(newSize >= 0 && newSize <= numParticles);
+
+    numParticles = newSize;
+
+    const int paddedSize = (numParticles + c_laneCount - 1) / c_laneCount * c_laneCount;
+    for (auto& field : fields)
+        field.resize(paddedSize);
+
+    for (int i = numParticles; i < paddedSize; i++)
+        setPadding(i);
+}
+
+void ParticleStore::add(const glm::vec3& position, float size, const glm::vec3& initialPositionNorm, float escapeProb)
+{
+    if (numParticles % c_laneCount == 0)
+    {
+        for (auto& field : fields)
+            field.insertMultiple(-1, 0.0f, c_laneCount);
+
+        for (int i = numParticles; i < numParticles + c_laneCount; i++)
+            setPadding(i);
+    }
+
+    const int i = numParticles++;
+    fields[posX].set(i, position.x);
+    fields[posY].set(i, position.y);
+    fields[posZ].set(i, position.z);
+    fields[velX].set(i, 0.0f);
+    fields[velY].set(i, 0.0f);
+    fields[velZ].set(i, 0.0f);
+    fields[initX].set(i, initialPositionNorm.x);
+    fields[initY].set(i, initialPositionNorm.y);
+    fields[initZ].set(i, initialPositionNorm.z);
+    fields[mouseSnappinessMultiplier].set(i, 1.0f);
+    fields[escapeSnappinessMultiplier].set(i, 1.0f);
+    fields[escapeProbability].set(i, escapeProb);
+    fields[particleSize].set(i, size);
+}
+
+void ParticleStore::setPadding(int i)
+{
+    // A particle at rest on the unit sphere keeps every intermediate value finite
+    for (auto& field : fields)
+        field.set(i, 0.0f);
+
+    fields[posX].set(i, 1.0f);
+    fields[initX].set(i, 1.0f);
+    fields[mouseSnappinessMultiplier].set(i, 1.0f);
+    fields[escapeSnappinessMultiplier].set(i, 1.0f);
+    fields[escapeProbability].set(i, 1.0f);
+}
+
+//==============================================================================
+namespace
+{
+    struct Vec3x4
+    {
+        Float4 x, y, z;
+
+        friend Vec3x4 operator+(const Vec3x4& a, const Vec3x4& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+        friend Vec3x4 operator-(const Vec3x4& a, const Vec3x4& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+        friend Vec3x4 operator*(const Vec3x4& a, Float4 s)        { return { a.x * s, a.y * s, a.z * s }; }
+        friend Vec3x4 operator/(const Vec3x4& a, Float4 s)        { return { a.x / s, a.y / s, a.z / s }; }
+
+        static Vec3x4 broadcast(const glm::vec3& v) { return { Float4::broadcast(v.x), Float4::broadcast(v.y), Float4::broadcast(v.z) }; }
+    };
+
+    inline Float4 dot(const Vec3x4& a, const Vec3x4& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    inline Float4 length(const Vec3x4& a) { return sqrt(dot(a, a)); }
+
+    inline Vec3x4 select(Mask4 mask, const Vec3x4& a, const Vec3x4& b)
+    {
+        return { select(mask, a.x, b.x), select(mask, a.y, b.y), select(mask, a.z, b.z) };
+    }
+
+    /// Same as glm::mix: a * (1 - t) + b * t
+    inline Float4 mix(Float4 a, Float4 b, Float4 t) { return a * (Float4::broadcast(1.0f) - t) + b * t; }
+    inline Vec3x4 mix(const Vec3x4& a, const Vec3x4& b, Float4 t) { return { mix(a.x, b.x, t), mix(a.y, b.y, t), mix(a.z, b.z, t) }; }
+
+    /// Same as glm::smoothstep
+    inline Float4 smoothstep(Float4 edge0, Float4 edge1, Float4 x)
+    {
+        const Float4 t = min(max((x - edge0) / (edge1 - edge0), Float4::broadcast(0.0f)), Float4::broadcast(1.0f));
+        return t * t * (Float4::broadcast(3.0f) - Float4::broadcast(2.0f) * t);
+    }
+
+    inline Float4 bilinearInterpolate(Float4 value00, Float4 value10, Float4 value01, Float4 value11, Float4 px, Float4 py)
+    {
+        return mix(mix(value00, value10, px), mix(value01, value11, px), py);
+    }
+
+    inline Float4 abs(Float4 a) { return max(a, Float4::broadcast(0.0f) - a); }
+
+    /// Uniform random values in [-0.5, 0.5) for one component of 4 consecutive particles
+    inline Float4 randomJitter(juce::uint32 seed, int firstParticle, juce::uint32 component)
+    {
+        const UInt4 key = UInt4::sequence((juce::uint32)firstParticle) * UInt4::broadcast(3) + UInt4::broadcast(component);
+        return hash(key ^ UInt4::broadcast(seed)).toUnitFloat() - Float4::broadcast(0.5f);
+    }
+}
+
+//==============================================================================
+void ParticleStore::update(const ParticleUpdateUniforms& u, int begin, int end, ParticleInstance* instances)
+{
+    using Region = ParticleUpdateUniforms::Region;
+
+    jassert(begin % c_laneCount == 0);
+    jassert(begin >= 0 && end <= numParticles);
+
+    const Float4 zero = Float4::broadcast(0.0f);
+    const Float4 one = Float4::broadcast(1.0f);
+    const Float4 deltaTime = Float4::broadcast(u.deltaTime);
+    const Float4 halfDeltaTimeSquared = Float4::broadcast(0.5f * u.deltaTime * u.deltaTime);
+
+    // Only the x, y and w rows of the MVP matrix are needed to find the screen position
+    Float4 mvpX[4], mvpY[4], mvpW[4];
+    for (int col = 0; col < 4; col++)
+    {
+        mvpX[col] = Float4::broadcast(u.mvpMatrix[col][0]);
+        mvpY[col] = Float4::broadcast(u.mvpMatrix[col][1]);
+        mvpW[col] = Float4::broadcast(u.mvpMatrix[col][3]);
+    }
+
+    const Float4 bandEdge0X = Float4::broadcast(u.bandSize.x * (1.0f - u.bandSmoothness));
+    const Float4 bandEdge1X = Float4::broadcast(u.bandSize.x * (1.0f + u.bandSmoothness));
+    const Float4 bandEdge0Y = Float4::broadcast(u.bandSize.y * (1.0f - u.bandSmoothness));
+    const Float4 bandEdge1Y = Float4::broadcast(u.bandSize.y * (1.0f + u.bandSmoothness));
+
+    Float4 regionColours[Region::c_numRegions][4];
+    Float4 regionTargetRadii[Region::c_numRegions];
+    for (int r = 0; r < Region::c_numRegions; r++)
+    {
+        for (int c = 0; c < 4; c++)
+            regionColours[r][c] = Float4::broadcast(u.regionColours[r][c]);
+
+        regionTargetRadii[r] = Float4::broadcast(u.regionTargetRadii[r]);
+    }
+
+    const Float4 accelerationFactor = Float4::broadcast(u.accelerationFactor);
+    const Float4 jitterFactor = Float4::broadcast(u.jitterFactor);
+    const Float4 baseRadius = Float4::broadcast(u.baseRadius);
+    const Float4 snapAmount = Float4::broadcast(u.snapAmount);
+    const Float4 snapFactor = Float4::broadcast(u.snapFactor);
+    const Float4 velDampingFactor = Float4::broadcast(u.velDampingFactor);
+    const Float4 inactivation = Float4::broadcast(1.0f - u.activationValue);
+    const Float4 escapeSpeedMultiplier = Float4::broadcast(u.escapeSpeedMultiplier);
+    const Float4 escapeSnapMultiplierStep = Float4::broadcast(u.escapeSnapMultiplierStep);
+    const Float4 mouseSnapMultiplierStep = Float4::broadcast(u.mouseSnapMultiplierStep);
+
+    const Vec3x4 cameraWorldPos = Vec3x4::broadcast(u.cameraWorldPos);
+    const Vec3x4 mouseRay = Vec3x4::broadcast(u.mouseRay);
+    const Float4 mouseEffectRadius = Float4::broadcast(u.mouseEffectRadius);
+    const Float4 mouseForceScale = Float4::broadcast(u.mouseRepulsionForce * u.mouseSpeed);
+
+    float* const p[c_numFields] = {
+        fields[posX].getRawDataPointer(), fields[posY].getRawDataPointer(), fields[posZ].getRawDataPointer(),
+        fields[velX].getRawDataPointer(), fields[velY].getRawDataPointer(), fields[velZ].getRawDataPointer(),
+        fields[initX].getRawDataPointer(), fields[initY].getRawDataPointer(), fields[initZ].getRawDataPointer(),
+        fields[mouseSnappinessMultiplier].getRawDataPointer(),
+        fields[escapeSnappinessMultiplier].getRawDataPointer(),
+        fields[escapeProbability].getRawDataPointer(),
+        fields[particleSize].getRawDataPointer()
+    };
+
+    for (int i = begin; i < end; i += c_laneCount)
+    {
+        Vec3x4 position { Float4::load(p[posX] + i), Float4::load(p[posY] + i), Float4::load(p[posZ] + i) };
+        Vec3x4 velocity { Float4::load(p[velX] + i), Float4::load(p[velY] + i), Float4::load(p[velZ] + i) };
+        const Vec3x4 initialPositionNorm { Float4::load(p[initX] + i), Float4::load(p[initY] + i), Float4::load(p[initZ] + i) };
+        Float4 mouseSnap = Float4::load(p[mouseSnappinessMultiplier] + i);
+        Float4 escapeSnap = Float4::load(p[escapeSnappinessMultiplier] + i);
+
+        // Screen space position decides which region's colour and radius the particle takes on
+        const Float4 clipX = mvpX[0] * position.x + mvpX[1] * position.y + mvpX[2] * position.z + mvpX[3];
+        const Float4 clipY = mvpY[0] * position.x + mvpY[1] * position.y + mvpY[2] * position.z + mvpY[3];
+        const Float4 clipW = mvpW[0] * position.x + mvpW[1] * position.y + mvpW[2] * position.z + mvpW[3];
+        const Float4 screenX = clipX / clipW;
+        const Float4 screenY = clipY / clipW;
+
+        const Float4 bandCoordX = smoothstep(bandEdge0X, bandEdge1X, abs(screenX));
+        const Float4 bandCoordY = smoothstep(bandEdge0Y, bandEdge1Y, abs(screenY));
+        const Mask4 isNorth = screenY > zero;
+
+        Float4 colour[4];
+        for (int c = 0; c < 4; c++)
+        {
+            colour[c] = bilinearInterpolate(regionColours[Region::Core][c],
+                                            regionColours[Region::Equator][c],
+                                            regionColours[Region::Meridian][c],
+                                            select(isNorth, regionColours[Region::North][c], regionColours[Region::South][c]),
+                                            bandCoordX, bandCoordY);
+        }
+
+        const Float4 targetDistanceFromCentre = bilinearInterpolate(regionTargetRadii[Region::Core],
+                                                                    regionTargetRadii[Region::Equator],
+                                                                    regionTargetRadii[Region::Meridian],
+                                                                    select(isNorth, regionTargetRadii[Region::North], regionTargetRadii[Region::South]),
+                                                                    bandCoordX, bandCoordY);
+
+        // Spring towards the target radius
+        const Float4 currentDistanceFromCentre = length(position);
+        const Float4 distanceDiff = currentDistanceFromCentre - targetDistanceFromCentre;
+        const Vec3x4 normPos = position / currentDistanceFromCentre;
+        Vec3x4 acceleration = normPos * (zero - accelerationFactor * distanceDiff);
+
+        // Jitter tangent to the sphere's surface, only when outside the target radius
+        const Mask4 isOutside = distanceDiff > zero;
+        Vec3x4 jitter = Vec3x4 {
+            randomJitter(u.randomSeed, i, 0),
+            randomJitter(u.randomSeed, i, 1),
+            randomJitter(u.randomSeed, i, 2)
+        } * (distanceDiff * jitterFactor);
+        jitter = jitter - normPos * dot(jitter, normPos);
+        acceleration = select(isOutside, acceleration + jitter, acceleration);
+
+        // Mouse response
+        if (u.useMouse)
+        {
+            const Vec3x4 positionRelativeToCamera = position - cameraWorldPos;
+            const Vec3x4 offsetFromMouseRay = positionRelativeToCamera - mouseRay * dot(positionRelativeToCamera, mouseRay);
+            const Float4 distanceFromMouseRay = length(offsetFromMouseRay);
+            const Mask4 isNearMouse = (distanceFromMouseRay > zero) & (distanceFromMouseRay < mouseEffectRadius);
+
+            const Float4 magnitude = one - distanceFromMouseRay / mouseEffectRadius;
+            const Vec3x4 mouseForce = offsetFromMouseRay * (magnitude * mouseForceScale / distanceFromMouseRay);
+            acceleration = select(isNearMouse, acceleration + mouseForce, acceleration);
+            mouseSnap = select(isNearMouse, zero, mouseSnap);
+        }
+
+        // Snappiness
+        const Vec3x4 targetPosition = initialPositionNorm * targetDistanceFromCentre;
+        const Vec3x4 snapPosition = targetPosition + (position - targetPosition) * snapFactor;
+        const Vec3x4 snapVelocity = (snapPosition - position) / deltaTime;
+        velocity = mix(velocity, snapVelocity, snapAmount * mouseSnap * escapeSnap);
+
+        // s = u t + 1/2 a t^2
+        position = position + velocity * deltaTime + acceleration * halfDeltaTimeSquared;
+
+        // v = u + a t, then damping
+        velocity = (velocity + acceleration * deltaTime) * velDampingFactor;
+
+        // Snapping to sphere when no activation
+        position = mix(position, initialPositionNorm * baseRadius, inactivation * mouseSnap);
+
+        // Escape
+        const Float4 radialSpeed = dot(velocity, normPos);
+        escapeSnap = select(radialSpeed * escapeSpeedMultiplier > Float4::load(p[escapeProbability] + i), zero, escapeSnap);
+
+        // Mouse and escape effect decay
+        mouseSnap = min(mouseSnap + mouseSnapMultiplierStep, one);
+        escapeSnap = min(escapeSnap + escapeSnapMultiplierStep, one);
+
+        position.x.store(p[posX] + i);
+        position.y.store(p[posY] + i);
+        position.z.store(p[posZ] + i);
+        velocity.x.store(p[velX] + i);
+        velocity.y.store(p[velY] + i);
+        velocity.z.store(p[velZ] + i);
+        mouseSnap.store(p[mouseSnappinessMultiplier] + i);
+        escapeSnap.store(p[escapeSnappinessMultiplier] + i);
+
+        // Interleave into one particle per 8 floats, then pack each one for the instance buffer
+        const Float4 size = Float4::load(p[particleSize] + i);
+        float group[c_laneCount * 8];
+        storeInterleaved8(group,
+                          position.x, position.y, position.z, size,
+                          colour[0], colour[1], colour[2], colour[3]);
+        
+        for (int lane = 0; lane < juce::jmin(c_laneCount, end - i); lane++)
+        {
+            const float* particle = group + lane * 8;
+            auto& instance = instances[i + lane];
+            instance.in_particlePositionAndSize = {
+                bsgl::Half::fromFloat(particle[0]),
+                bsgl::Half::fromFloat(particle[1]),
+                bsgl::Half::fromFloat(particle[2]),
+                bsgl::Half::fromFloat(particle[3])
+            };
+            instance.in_colour = bsgl::UByteVec4Normalised::fromFloats(particle[4], particle[5], particle[6], particle[7]);
+        }
+    }
+}
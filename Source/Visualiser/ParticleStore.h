@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    ParticleStore.h
+    Created: 17 Oct 2026 1:40:18pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <glm/glm.hpp>
+
+#include "VisualiserProcessor.h"
+#include "../bsgl/PackedTypes.h"
+
+//==============================================================================
+/// Everything the particle update needs that is the same for every particle in a frame
+struct ParticleUpdateUniforms
+{
+    using Region = VisualiserProcessor::Region;
+    
+    float deltaTime = 0.0f;
+    glm::mat4 mvpMatrix { 1.0f };
+    
+    glm::vec2 bandSize { 0.0f };
+    float bandSmoothness = 0.0f;
+    glm::vec4 regionColours[Region::c_numRegions];
+    float regionTargetRadii[Region::c_numRegions];
+    
+    float baseRadius = 1.0f;
+    float activationValue = 0.0f;
+    float accelerationFactor = 0.0f;
+    float jitterFactor = 0.0f;
+    float snapAmount = 0.0f;
+    float snapFactor = 0.0f;
+    float velDampingFactor = 1.0f;
+    float escapeSpeedMultiplier = 0.0f;
+    float escapeSnapMultiplierStep = 0.0f;
+    
+    bool useMouse = false;
+    glm::vec3 cameraWorldPos { 0.0f };
+    glm::vec3 mouseRay { 0.0f };
+    float mouseSpeed = 0.0f;
+    float mouseEffectRadius = 0.0f;
+    float mouseRepulsionForce = 0.0f;
+    float mouseSnapMultiplierStep = 0.0f;
+    
+    /// Different every frame; jitter is a pure function of this and the particle index
+    juce::uint32 randomSeed = 0;
+};
+
+//==============================================================================
+/// What the GPU gets for each particle, packed into 12 bytes. The member names are the
+/// particle shader's attribute names.
+struct ParticleInstance
+{
+    bsgl::HalfVec4 in_particlePositionAndSize;
+    bsgl::UByteVec4Normalised in_colour;
+};
+
+static_assert(sizeof(ParticleInstance) == 12);
+
+//==============================================================================
+/// Particle state stored as a structure of arrays, so that the update can run on 4 particles at once.
+/// Every array is padded to a multiple of 4 with particles that sit still on the unit sphere.
+class ParticleStore
+{
+public:
+    static constexpr int c_laneCount = 4;
+    
+    int size() const { return numParticles; }
+    
+    void clear();
+    
+    /// Shrinks the store; new particles can only be added with add()
+    void truncate(int newSize);
+    
+    void add(const glm::vec3& position, float particleSize, const glm::vec3& initialPositionNorm, float escapeProbability);
+    
+    /// Updates particles [begin, end) and writes their instance data to instances + begin.
+    /// begin must be a multiple of c_laneCount. Separate ranges can be updated concurrently.
+    void update(const ParticleUpdateUniforms& uniforms, int begin, int end, ParticleInstance* instances);
+    
+private:
+    enum Field
+    {
+        posX, posY, posZ,
+        velX, velY, velZ,
+        initX, initY, initZ,
+        mouseSnappinessMultiplier,
+        escapeSnappinessMultiplier,
+        escapeProbability,
+        particleSize,
+        c_numFields
+    };
+    
+    juce::Array<float> fields[c_numFields];
+    int numParticles = 0;
+    
+    void setPadding(int index);
+    
+    JUCE_LEAK_DETECTOR(ParticleStore)
+};
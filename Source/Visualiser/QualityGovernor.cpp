@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+    QualityGovernor.cpp
+    Created: 17 Oct 2026 4:25:37pm
+
+  ==============================================================================
+*/
+
+#include "QualityGovernor.h"
+
+//==============================================================================
+namespace
+{
+    // From full quality downwards. Halving the tick rate roughly halves the simulation cost
+    // while the GL thread carries on drawing at the display rate, so that goes first.
+    const QualityGovernor::Level c_levels[] = {
+        { 1.0f,  60 },
+        { 1.0f,  30 },
+        { 0.75f, 30 },
+        { 0.5f,  30 },
+        { 0.5f,  20 },
+        { 0.25f, 20 },
+        { 0.1f,  15 },
+    };
+
+    constexpr int c_numLevels = (int)std::size(c_levels);
+
+    // Readings must be under this fraction of the budget to count towards stepping up,
+    // leaving room for the cost of the level above
+    constexpr double c_raiseThreshold = 0.6;
+
+    constexpr int c_readingsToLower = 2;
+    constexpr int c_minReadingsToRaise = 3;
+    constexpr int c_maxReadingsToRaise = 60;
+}
+
+//==============================================================================
+bool QualityGovernor::addReading(double cpuFraction, double budgetFraction)
+{
+    if (readingsNeededToRaise.isEmpty())
+        readingsNeededToRaise.insertMultiple(0, c_minReadingsToRaise, c_numLevels);
+
+    if (cpuFraction > budgetFraction)
+    {
+        readingsUnderBudget = 0;
+
+        if (++readingsOverBudget >= c_readingsToLower && levelIndex < c_numLevels - 1)
+        {
+            // This level is too expensive at the moment, so be slower to come back to it
+            auto& needed = readingsNeededToRaise.getReference(levelIndex);
+            needed = juce::jmin(needed * 2, c_maxReadingsToRaise);
+
+            levelIndex++;
+            readingsOverBudget = 0;
+            return true;
+        }
+    }
+    else
+    {
+        readingsOverBudget = 0;
+
+        if (cpuFraction < budgetFraction * c_raiseThreshold)
+        {
+            if (levelIndex > 0 && ++readingsUnderBudget >= readingsNeededToRaise[levelIndex - 1])
+            {
+                levelIndex--;
+                readingsUnderBudget = 0;
+                return true;
+            }
+        }
+        else
+        {
+            readingsUnderBudget = 0;
+
+            // Comfortably within budget at this level, so forget that it was once too expensive
+            auto& needed = readingsNeededToRaise.getReference(levelIndex);
+            needed = juce::jmax(c_minReadingsToRaise, needed - 1);
+        }
+    }
+
+    return false;
+}
+
+const QualityGovernor::Level& QualityGovernor::getLevel() const
+{
+    return c_levels[levelIndex];
+}
+
+int QualityGovernor::getNumLevels()
+{
+    return c_numLevels;
+}
+
+void QualityGovernor::reset()
+{
+    levelIndex = 0;
+    readingsOverBudget = 0;
+    readingsUnderBudget = 0;
+    readingsNeededToRaise.clear();
+}
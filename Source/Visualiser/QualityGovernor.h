@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    QualityGovernor.h
+    Created: 17 Oct 2026 4:25:37pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/// Steps the visualiser's quality down when it uses more than its CPU budget, and back up
+/// when there is plenty of headroom. Fed with one reading per second.
+///
+/// Going down needs two readings over budget in a row, so a single hiccup (e.g. the DAW
+/// loading a plugin) is ignored. Going up needs several readings well under budget, and
+/// takes longer each time the same level has recently been found to be too expensive,
+/// so the governor settles instead of flickering between two levels.
+class QualityGovernor
+{
+public:
+    struct Level
+    {
+        /// Fraction of the particle count parameter that is simulated and drawn
+        float particleFraction;
+        int simulationTicksPerSecond;
+    };
+
+    /// Takes the CPU time used over the last second as a fraction of one core, and the budget
+    /// as the same. Returns true if the level has changed.
+    bool addReading(double cpuFraction, double budgetFraction);
+
+    const Level& getLevel() const;
+    int getLevelIndex() const { return levelIndex; }
+    static int getNumLevels();
+
+    /// Back to full quality, e.g. after the visualiser has been hidden for a while
+    void reset();
+
+private:
+    int levelIndex = 0;
+    int readingsOverBudget = 0;
+    int readingsUnderBudget = 0;
+
+    // Number of readings under budget needed to step up to each level; doubled whenever
+    // that level turns out to be over budget, and slowly relaxed while it isn't
+    juce::Array<int> readingsNeededToRaise;
+};
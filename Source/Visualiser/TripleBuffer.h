@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+
+    TripleBuffer.h
+    Created: 17 Oct 2026 2:31:06pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <atomic>
+
+//==============================================================================
+/// Lock-free single producer, single consumer triple buffer.
+/// The writer always has a buffer to fill and the reader always has a complete buffer to read,
+/// so neither side ever waits for the other. The reader sees the most recently published buffer;
+/// buffers published in between are skipped.
+template<typename T>
+class TripleBuffer
+{
+public:
+    //==========================================================================
+    /// Writer only: the buffer to fill before the next call to publish()
+    T& getWriteBuffer() { return buffers[writeIndex]; }
+    
+    /// Writer only: hands the write buffer to the reader, and takes the spare buffer to write into next
+    void publish()
+    {
+        const int previous = shared.exchange(writeIndex | c_newDataFlag, std::memory_order_acq_rel);
+        writeIndex = previous & c_indexMask;
+    }
+    
+    //==========================================================================
+    /// Reader only: if a buffer has been published since the last call, makes it the read buffer.
+    /// Returns true if the read buffer changed.
+    bool acquireLatest()
+    {
+        if ((shared.load(std::memory_order_relaxed) & c_newDataFlag) == 0)
+            return false;
+        
+        const int previous = shared.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & c_indexMask;
+        return true;
+    }
+    
+    /// Reader only: the most recently acquired buffer
+    const T& getReadBuffer() const { return buffers[readIndex]; }
+    
+private:
+    static constexpr int c_indexMask = 3;
+    static constexpr int c_newDataFlag = 4;
+    
+    T buffers[3];
+    int writeIndex = 0;
+    int readIndex = 1;
+    
+    /// Index of the spare buffer, plus c_newDataFlag if it was published but not yet acquired
+    std::atomic<int> shared { 2 };
+};
@@ -28,18 +28,30 @@ Visualiser::Visualiser(HydraAudioProcessor& pluginProc)
     context.setRenderer(this);
     context.attachTo(*this);
     //context.setSwapInterval(0);
-    context.setContinuousRepainting(true);
+    
+    // The simulation thread triggers a repaint for each new frame or turn of the model, so nothing is rendered
+    // while it's paused, or idle with the model still
+    context.setContinuousRepainting(false);
     
     for (auto* param : processor.getParameters())
     {
         param->addListener(this);
     }
     
-    initParticles(true);
+    simulation.initParticles(true);
+    
+    // Both counters report once a second on the message thread; the render one may be up to
+    // a second old, which doesn't matter for the governor
+    simulationCounter.onNewReading = [this](int, double simulationCpu) {
+        updateQuality(simulationCpu + fpsCounter.getCPU());
+    };
+    
+    simulationThread.startThread();
 }
 
 Visualiser::~Visualiser()
 {
+    simulationThread.stopThread(1000);
     context.detach();
     for (auto param : processor.getParameters())
     {
@@ -49,14 +61,26 @@ Visualiser::~Visualiser()
 
 void Visualiser::resized()
 {
-    updateViewProjMatrices();
+    updateCamera();
+}
+
+void Visualiser::visibilityChanged()
+{
+    // e.g. hidden behind the preset menu
+    const bool wasPaused = simulationPaused.exchange(!isVisible());
+    
+    // Whatever made the governor step down may well have gone away while hidden
+    if (wasPaused && isVisible())
+        resetQuality();
+    
+    simulationThread.notify();
 }
 
 void Visualiser::mouseDoubleClick(const juce::MouseEvent &event)
 {
     juce::ScopedLock csLock(criticalSection);
     
-    initParticles(true);
+    simulation.initParticles(true);
 }
 
 //==============================================================================
@@ -67,6 +91,8 @@ void Visualiser::newOpenGLContextCreated()
     DBG("newOpenGLContextCreated");
     
     state = std::make_unique<State>(context);
+    instanceDataUploaded = false;
+    DBG("Instance streaming mode " << (int)state->particleBuffer->getStreamingMode());
     
     recalculateBackgroundUVs();
 }
@@ -84,6 +110,8 @@ void Visualiser::openGLContextClosing()
 void Visualiser::mouseEnter(const juce::MouseEvent &event)
 {
     mouseMove(event);
+    
+    juce::ScopedLock csLock(criticalSection);
     mousePositionLastFrame = currentMousePosition;
 }
 
@@ -98,6 +126,9 @@ void Visualiser::mouseMove(const juce::MouseEvent &event)
         juce::jmap<float>(event.getPosition().x, 0, getWidth(),  -1.0f, +1.0f),
         juce::jmap<float>(event.getPosition().y, 0, getHeight(), +1.0f, -1.0f)
     };
+    
+    // Wake the simulation straight away if it's idle
+    simulationThread.notify();
 }
 
 
@@ -169,72 +200,6 @@ void Visualiser::recalculateBackgroundUVs()
     state->backgroundBuffer->setVertexData(backgroundVertices, GL_STATIC_DRAW);
 }
 
-//==============================================================================
-void Visualiser::initParticles(bool clearExisting)
-{
-    juce::ScopedLock csLock(criticalSection);
-    
-    if (clearExisting)
-    {
-        instances.clear();
-        particles.clear();
-    }
-    
-    int numInstances = processor.paramNumParticles->get();
-    
-    if (numInstances < instances.size())
-    {
-        instances.resize(numInstances);
-        particles.resize(numInstances);
-    }
-    else
-    {
-        const float baseRadius = processor.paramBaseRadius->get();
-        const float baseSize = processor.paramParticleSize->get();
-        const float sizeRange = processor.paramParticleSizeRandomness->get();
-        
-        while (instances.size() < numInstances)
-        {
-            ParticleShader::Instance newInstance;
-            
-            // Generate point inside unit sphere, by rejection sampling
-            glm::vec3 pos;
-            do {
-                pos = {
-                    (rng.nextFloat() - 0.5f) * 2.0f,
-                    (rng.nextFloat() - 0.5f) * 2.0f,
-                    (rng.nextFloat() - 0.5f) * 2.0f
-                };
-            } while (glm::dot(pos, pos) > 1.0f);
-            
-            // Normalise onto the sphere
-            pos = glm::normalize(pos);
-            
-            newInstance.in_particlePosition = pos * baseRadius;
-            newInstance.in_colour = {
-                rng.nextFloat(),
-                rng.nextFloat(),
-                rng.nextFloat(),
-                1.0f
-            };
-            newInstance.in_particleSize = baseSize * randomFloat(1.0f - sizeRange, 1.0f + sizeRange);
-            
-            instances.add(newInstance);
-            
-            Particle newParticle;
-            newParticle.initialPositionNorm = pos;
-            newParticle.velocity = glm::vec3(0.0f);
-            newParticle.mouseSnappinessMultiplier = 1.0f;
-            newParticle.escapeSnappinessMultiplier = 1.0f;
-            newParticle.escapeProbability = randomFloat(0.0f, 1.0f);
-
-            particles.add(newParticle);
-        }
-    }
-    
-    jassert(instances.size() == particles.size());
-}
-
 //==============================================================================
 void Visualiser::parameterValueChanged(int parameterIndex, float newValue)
 {
@@ -242,74 +207,54 @@ void Visualiser::parameterValueChanged(int parameterIndex, float newValue)
         parameterIndex == processor.paramCameraZPos->getParameterIndex() ||
         parameterIndex == processor.paramCameraFOV->getParameterIndex())
     {
-        updateViewProjMatrices();
+        updateCamera();
     }
     else if (parameterIndex == processor.paramNumParticles->getParameterIndex())
     {
-        initParticles(false);
+        juce::ScopedLock csLock(criticalSection);
+        simulation.initParticles(false);
     }
     else if (parameterIndex == processor.paramParticleSize->getParameterIndex() ||
              parameterIndex == processor.paramParticleSizeRandomness->getParameterIndex())
     {
-        initParticles(true);
+        juce::ScopedLock csLock(criticalSection);
+        simulation.initParticles(true);
     }
 }
 
-void Visualiser::updateViewProjMatrices()
+void Visualiser::updateCamera()
 {
     juce::ScopedLock csLock(criticalSection);
     
     if (getWidth() > 0 && getHeight() > 0)
     {
-        projMatrix = glm::perspective(glm::radians(processor.paramCameraFOV->get()),
-                                      getLocalBounds().toFloat().getAspectRatio(),
-                                      0.1f,
-                                      50.0f);
-        invProjMatrix = glm::inverse(projMatrix);
-        cameraPos = glm::vec3 { 0.0f, processor.paramCameraYPos->get(), processor.paramCameraZPos->get() };
-        viewMatrix = glm::lookAt(cameraPos,
-                                 glm::vec3 { 0.0f, 0.0f, 0.0f },
-                                 glm::vec3 { 0.0f, 1.0f, 0.0f });
-        invViewMatrix = glm::inverse(viewMatrix);
+        simulation.setCamera(ParticleSimulation::Camera::fromParameters(processor, getLocalBounds().toFloat().getAspectRatio()));
+        hasCamera = true;
     }
 }
 
-//==============================================================================
-template<typename T>
-T bilinearInterpolate(const T& value00,
-                      const T& value10,
-                      const T& value01,
-                      const T& value11,
-                      const glm::vec2& p)
+//=============================================================================
+bool Visualiser::isInputAboveThreshold() const
 {
-    T valueX0 = glm::mix(value00, value10, p.x);
-    T valueX1 = glm::mix(value01, value11, p.x);
-    return glm::mix(valueX0, valueX1, p.y);
+    const float inputVolume = pluginProcessor.inputMeter->getMeterValue(0);
+    const float inputVolumeThreshold = processor.paramActivationThreshold->get();
+    return inputVolume >= inputVolumeThreshold || inputVolumeThreshold <= juce::Decibels::decibelsToGain(-99.0f);
 }
 
-template<typename T>
-T calculateExponentialFactor(T timeMS, double sampleRate)
+bool Visualiser::hasActivity() const
 {
-    static constexpr T log2 = static_cast<T>(0.6931471805599453);
-    
-    if (timeMS > 0.001)
-        return static_cast<T>(exp(-log2 / (timeMS / 1000.0 * sampleRate)));
-    else
-        return static_cast<T>(0.0);
+    const glm::vec2 mouseScreenPos = currentMousePosition;
+    return isInputAboveThreshold() || activationValue > 0.0f || mouseScreenPos.x >= -1.0f;
 }
 
-template<typename T, typename U>
-T calculateExponentialMovingAverage(const T& lastValue, const T& inputValue, U expFactor)
+bool Visualiser::isRotating() const
 {
-    return inputValue + expFactor * (lastValue - inputValue);
+    return !juce::approximatelyEqual(processor.paramRotationSpeed->get(), 0.0f);
 }
 
-//=============================================================================
-void Visualiser::updateParticles(float deltaTime)
+void Visualiser::updateActivation(float deltaTime)
 {
-    const float inputVolume = pluginProcessor.inputMeter->getMeterValue(0);
-    const float inputVolumeThreshold = processor.paramActivationThreshold->get();
-    if (inputVolume >= inputVolumeThreshold || inputVolumeThreshold <= juce::Decibels::decibelsToGain(-99.0f))
+    if (isInputAboveThreshold())
     {
         if (activationValue < 1.0f)
         {
@@ -325,199 +270,152 @@ void Visualiser::updateParticles(float deltaTime)
             activationValue = juce::jlimit(0.0f, 1.0f, activationValue);
         }
     }
-    
-    const float mouseEffectRadius = processor.paramMouseEffectRadius->get();
-    const float mouseRepulsionForce = processor.paramMouseRepulsion->get();
-    const float mouseSnapMultiplierStep = deltaTime / processor.paramMouseEffectDuration->get();
-    const glm::vec2 mouseScreenPos = currentMousePosition;
-    bool useMouse = (mouseScreenPos.x >= -1.0f && mouseEffectRadius > 0.0f);
-    const glm::vec3 cameraWorldPos = invModelMatrix * glm::vec4 { cameraPos, 1.0f };
-    
-    glm::vec3 mouseRay;
-    float mouseSpeed;
-    if (useMouse)
-    {
-        glm::vec4 mouseWorldPos = invModelMatrix * invViewMatrix * invProjMatrix * glm::vec4(mouseScreenPos, 0.5f, 1.0f);
-        mouseWorldPos /= mouseWorldPos.w;
-        mouseRay = glm::vec3 { mouseWorldPos } - cameraWorldPos;
-        mouseRay = glm::normalize(mouseRay);
-        
-        mouseSpeed = glm::distance(mousePositionLastFrame, mouseScreenPos) / deltaTime;
-        if (juce::approximatelyEqual(mouseSpeed, 0.0f))
-            useMouse = false;
-        
-        mousePositionLastFrame = mouseScreenPos;
-    }
-
-    const float escapeSpeedMultiplier = processor.paramEscapeSpeedMultiplier->get();
-    const float escapeSnapMultiplierStep = deltaTime / 1.0f; processor.paramEscapeDuration->get();
-
-    const float snapAmount = processor.paramMovementStyle->get();
-    const float snapFactor = calculateExponentialFactor(processor.paramSnappySpeed->get(), 1.0 / deltaTime);
-    
-    const float velDampingFactor = pow(1.0f - processor.paramDampingFactor->get(), deltaTime);
-    const float accelerationFactor = processor.paramForceScale->get();
-    const float jitterFactor = processor.paramJitterAmount->get();
-    const float baseRadius = processor.paramBaseRadius->get();
-    const glm::vec2 bandSize(processor.paramHorizontalBandSize->get(),
-                             processor.paramVerticalBandSize->get());
-    const float bandSmoothness = processor.paramBandSmoothness->get();
-    
-    glm::vec4 regionColours[Region::c_numRegions];
-    float regionTargetRadii[Region::c_numRegions];
-    
-    for (int i=0; i<Region::c_numRegions; i++)
-    {
-        regionColours[i] = glm::mix(glm::vec4(1.0f), processor.regionColours[i]->getVec4(), activationValue);
-        regionTargetRadii[i] = baseRadius * glm::mix(1.0f, 1.0f + processor.paramRegionRadiusMod[i]->get(), activationValue);
-    }
+}
 
-    glm::mat4 mvpMatrix = projMatrix * viewMatrix * modelMatrix;
+//==============================================================================
+void Visualiser::SimulationThread::run()
+{
+    double nextTickTime = juce::Time::getMillisecondCounterHiRes();
+    double lastActiveTime = nextTickTime;
+    double lastStepTime = 0.0;
     
-    for (int i=0; i<instances.size(); i++)
+    while (!threadShouldExit())
     {
-        auto& instance = instances.getReference(i);
-        auto& particle = particles.getReference(i);
-        
-        glm::vec4 screenSpacePos4 = mvpMatrix * glm::vec4(instance.in_particlePosition, 1.0f);
-        glm::vec2 screenSpacePos(screenSpacePos4.x / screenSpacePos4.w,
-                                 screenSpacePos4.y / screenSpacePos4.w);
+        if (visualiser.simulationPaused)
+        {
+            wait(-1);
+            nextTickTime = lastActiveTime = juce::Time::getMillisecondCounterHiRes();
+            continue;
+        }
         
-        // Without smoothing, bandCoord would have x = {0, +1} and y = {0, +1}
-        // where 0 means the point is inside the central (equator or meridian) band
-        // and 1 means it's outside
-        glm::vec2 bandCoord = glm::smoothstep(bandSize * (1.0f - bandSmoothness),
-                                              bandSize * (1.0f + bandSmoothness),
-                                              glm::abs(screenSpacePos)
-                                              );
+        // The rate can be changed by the quality governor at any time
+        const int ticksPerSecond = visualiser.simulationTicksPerSecond;
+        const double tickStartTime = juce::Time::getMillisecondCounterHiRes();
         
-        const Region region00 = Region::Core;
-        const Region region10 = Region::Equator;
-        const Region region01 = Region::Meridian;
-        const Region region11 = (screenSpacePos.y > 0) ? Region::North : Region::South;
-
-        instance.in_colour = bilinearInterpolate(regionColours[region00],
-                                                 regionColours[region10],
-                                                 regionColours[region01],
-                                                 regionColours[region11],
-                                                 bandCoord);
-
-        float targetDistanceFromCentre = bilinearInterpolate(regionTargetRadii[region00],
-                                                             regionTargetRadii[region10],
-                                                             regionTargetRadii[region01],
-                                                             regionTargetRadii[region11],
-                                                             bandCoord);
-
-        float currentDistanceFromCentre = glm::length(instance.in_particlePosition);
-        float distanceDiff = currentDistanceFromCentre - targetDistanceFromCentre;
-        auto normPos = instance.in_particlePosition / currentDistanceFromCentre;
-        auto acceleration = -accelerationFactor * distanceDiff * normPos;
+        if (visualiser.hasActivity())
+            lastActiveTime = tickStartTime;
         
-        if (distanceDiff > 0.0f)
+        // Once things have settled, only step occasionally, but keep checking for activity at the full rate
+        const bool isIdle = tickStartTime - lastActiveTime > c_secondsBeforeIdle * 1000.0;
+        if (!isIdle)
         {
-            auto jitter = distanceDiff * jitterFactor * glm::vec3 {
-                rng.nextFloat() - 0.5f,
-                rng.nextFloat() - 0.5f,
-                rng.nextFloat() - 0.5f
-            };
-            
-            // This causes the jitter vector to be tangent to the sphere's surface
-            // by subtracting the projection towards the centre
-            jitter -= glm::dot(jitter, normPos) * normPos;
-            
-            acceleration += jitter;
+            visualiser.simulate(1.0f / ticksPerSecond);
+            lastStepTime = tickStartTime;
         }
-        
-        // Mouse response
-        if (useMouse)
+        else
         {
-            glm::vec3 positionRelativeToCamera = instance.in_particlePosition - cameraWorldPos;
-            glm::vec3 projectionOntoMouseRay = glm::dot(positionRelativeToCamera, mouseRay) * mouseRay;
-            glm::vec3 offsetFromMouseRay = positionRelativeToCamera - projectionOntoMouseRay;
+            // The rotation is advanced every tick here, so the occasional step mustn't advance it again
+            if (visualiser.isRotating())
+                visualiser.rotate(1.0f / ticksPerSecond);
             
-            float distanceFromMouseRay = glm::length(offsetFromMouseRay);
-            if (distanceFromMouseRay > 0.0f && distanceFromMouseRay < mouseEffectRadius)
+            if (tickStartTime - lastStepTime >= 1000.0 / c_idleTicksPerSecond)
             {
-                float magnitude = 1.0f - distanceFromMouseRay / mouseEffectRadius;
-                glm::vec3 mouseForce = magnitude * mouseRepulsionForce * offsetFromMouseRay / distanceFromMouseRay;
-                acceleration += mouseForce * mouseSpeed;
-                particle.mouseSnappinessMultiplier = 0.0f;
+                visualiser.simulate(1.0f / c_idleTicksPerSecond, false);
+                lastStepTime = tickStartTime;
             }
         }
-
-        // Snappiness
-        auto snapPosition = calculateExponentialMovingAverage(instance.in_particlePosition,
-                                                              targetDistanceFromCentre * particle.initialPositionNorm,
-                                                              snapFactor);
-        auto snapVelocity = (snapPosition - instance.in_particlePosition) / deltaTime;
-        particle.velocity = glm::mix(particle.velocity,
-                                     snapVelocity,
-                                     snapAmount * particle.mouseSnappinessMultiplier * particle.escapeSnappinessMultiplier);
-
-        // s = u t + 1/2 a t^2
-        instance.in_particlePosition += particle.velocity * deltaTime + acceleration * (0.5f * deltaTime * deltaTime);
-        
-        // v = u + a t
-        particle.velocity += acceleration * deltaTime;
         
-        // Damping
-        particle.velocity *= velDampingFactor;
+        nextTickTime += 1000.0 / ticksPerSecond;
+        const double now = juce::Time::getMillisecondCounterHiRes();
         
-        // Snapping to sphere when no activation
-        instance.in_particlePosition = glm::mix(instance.in_particlePosition,
-                                                particle.initialPositionNorm * baseRadius,
-                                                (1.0f - activationValue) * particle.mouseSnappinessMultiplier);
-        
-        // Escape
-        float radialSpeed = glm::dot(particle.velocity, normPos);
-        if (radialSpeed * escapeSpeedMultiplier > particle.escapeProbability)
-        {
-            particle.escapeSnappinessMultiplier = 0.0f;
-        }
-        
-        // Mouse effect decay
-        if (particle.mouseSnappinessMultiplier < 1.0f)
-        {
-            particle.mouseSnappinessMultiplier = glm::min(particle.mouseSnappinessMultiplier + mouseSnapMultiplierStep, 1.0f);
-        }
-
-        if (particle.escapeSnappinessMultiplier < 1.0f)
-        {
-            particle.escapeSnappinessMultiplier = glm::min(particle.escapeSnappinessMultiplier + escapeSnapMultiplierStep, 1.0f);
-        }
+        // If a tick overran, carry on from now rather than trying to catch up
+        if (nextTickTime < now)
+            nextTickTime = now;
+        else
+            wait(juce::roundToInt(nextTickTime - now));
     }
 }
 
-//==============================================================================
-void Visualiser::renderOpenGL()
+void Visualiser::simulate(float deltaTime, bool advanceRotation)
 {
-    fpsCounter.beginFrame();
-
-    // Calculate delta time
-    int64_t frameTime = juce::Time::getHighResolutionTicks();
-    float deltaTime = (float)juce::Time::highResolutionTicksToSeconds(frameTime - lastFrameTime);
-    if (!isfinite(deltaTime) || deltaTime > 1.0)
-        deltaTime = 1.0;
-    lastFrameTime = frameTime;
-
-    // Preparations
     juce::ScopedLock csLock(criticalSection);
-    jassert (juce::OpenGLHelpers::isContextActive());
-   
+    
+    // Nothing sensible can be simulated until the camera has been set up for the component's size
+    if (!hasCamera)
+        return;
+    
+    simulationCounter.beginFrame();
+    
     // Update parameter routings
     // Note that this doesn't take the engine's atomic mode setting into account -- may need to change this?
     processor.processParameterRoutings(true);
     
-    // Update rotation
-    float rotationStep = glm::radians(processor.paramRotationSpeed->get()) * (float)deltaTime;
-    rotationAngle = fmod(rotationAngle + rotationStep, juce::MathConstants<float>::twoPi);
-    modelMatrix = glm::rotate(glm::mat4(1.0f), rotationAngle, glm::vec3 { 0.0f, 1.0f, 0.0f });
-    invModelMatrix = glm::rotate(glm::mat4(1.0f), -rotationAngle, glm::vec3 { 0.0f, 1.0f, 0.0f });
+    updateActivation(deltaTime);
+    
+    ParticleSimulation::StepInput input;
+    input.deltaTime = deltaTime;
+    input.activationValue = activationValue;
+    input.advanceRotation = advanceRotation;
+    
+    const glm::vec2 mouseScreenPos = currentMousePosition;
+    if (mouseScreenPos.x >= -1.0f)
+    {
+        input.useMouse = true;
+        input.mouseRay = simulation.getCamera().getRayThroughScreenPoint(mouseScreenPos);
+        input.mouseSpeed = glm::distance(mousePositionLastFrame, mouseScreenPos) / deltaTime;
+        mousePositionLastFrame = mouseScreenPos;
+    }
+    
+    // Positions, colours and sizes are written straight into the next frame for the GL thread
+    auto& frame = frames.getWriteBuffer();
+    frame.instances.resize(simulation.getNumParticles());
+    simulation.step(input, frame.instances.getRawDataPointer());
+    
+    const auto& camera = simulation.getCamera();
+    frame.viewMatrix = camera.viewMatrix;
+    frame.projMatrix = camera.projMatrix;
+    
+    rotationAngle = simulation.getRotationAngle();
+    frames.publish();
+    context.triggerRepaint();
+    
+    simulationCounter.endFrame();
+    simulationCounter.addTicks(simulation.getLastStepWorkerTicks());
+}
+
+void Visualiser::rotate(float deltaTime)
+{
+    juce::ScopedLock csLock(criticalSection);
+    
+    if (!hasCamera)
+        return;
+    
+    simulation.advanceRotation(deltaTime);
+    rotationAngle = simulation.getRotationAngle();
+    context.triggerRepaint();
+}
+
+void Visualiser::updateQuality(double cpuFraction)
+{
+    if (qualityGovernor.addReading(cpuFraction, processor.paramCpuBudget->get()))
+        applyQualityLevel();
+}
+
+void Visualiser::resetQuality()
+{
+    qualityGovernor.reset();
+    applyQualityLevel();
+}
+
+void Visualiser::applyQualityLevel()
+{
+    const auto& level = qualityGovernor.getLevel();
+    simulationTicksPerSecond = level.simulationTicksPerSecond;
     
-    glm::mat4 modelViewMatrix = viewMatrix * modelMatrix;
+    juce::ScopedLock csLock(criticalSection);
+    simulation.setParticleFraction(level.particleFraction);
+}
+
+//==============================================================================
+void Visualiser::renderOpenGL()
+{
+    fpsCounter.beginFrame();
+
+    jassert (juce::OpenGLHelpers::isContextActive());
     
-    // Update particle positions etc
-    updateParticles(deltaTime);
+    // Pick up the latest frame from the simulation thread -- if there isn't a new one, draw the last one again
+    const bool isNewFrame = frames.acquireLatest();
+    const Frame& frame = frames.getReadBuffer();
 
     // Clear and prepare for drawing
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -544,18 +442,24 @@ void Visualiser::renderOpenGL()
 
     // Activate the shader and pass uniforms in
     state->particleShader->use();
-    state->particleShader->uniform_projectionMatrix->setMatrix4(glm::value_ptr(projMatrix), 1, false);
+    state->particleShader->uniform_projectionMatrix->setMatrix4(glm::value_ptr(frame.projMatrix), 1, false);
+    const glm::mat4 modelViewMatrix = frame.viewMatrix * ParticleSimulation::getModelMatrix(rotationAngle);
     state->particleShader->uniform_modelViewMatrix->setMatrix4(glm::value_ptr(modelViewMatrix), 1, false);
     state->particleShader->uniform_particleSmoothness->set(processor.paramParticleSmoothness->get());
     state->particleShader->uniform_backgroundFadeCoefficient->set(fadeCoefficient);
     
     state->particleBuffer->bindVertexArray();
     
-    // Pass in updated instance data
-    state->particleBuffer->setInstanceData(instances, GL_DYNAMIC_DRAW);
+    // Pass in updated instance data. The simulation thread's frames can't be mapped GPU memory,
+    // as that has to be fenced on this thread, so this is a single copy straight into the buffer.
+    if (isNewFrame || !instanceDataUploaded)
+    {
+        state->particleBuffer->uploadInstanceData(frame.instances.getRawDataPointer(), frame.instances.size());
+        instanceDataUploaded = true;
+    }
 
     // Draw the VAO
-    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, instances.size());
+    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, frame.instances.size());
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
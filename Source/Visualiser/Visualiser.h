@@ -20,7 +20,10 @@
 
 #include "VisualiserProcessor.h"
 #include "ParticleShader.h"
+#include "ParticleSimulation.h"
+#include "QualityGovernor.h"
 #include "ScreenQuadImageShader.h"
+#include "TripleBuffer.h"
 
 class HydraAudioProcessor;
 
@@ -32,6 +35,7 @@ public:
     ~Visualiser() override;
 
     void resized() override;
+    void visibilityChanged() override;
     
     void mouseEnter(const juce::MouseEvent &event) override;
     void mouseExit(const juce::MouseEvent &event) override;
@@ -49,22 +53,21 @@ public:
 
     bsgl::FPSCounter fpsCounter;
     
+    const QualityGovernor& getQualityGovernor() const { return qualityGovernor; }
+    
     using Region = VisualiserProcessor::Region;
 
     //========================================================================
 private:
+    // Guards the simulation state. Held by the simulation thread for each step,
+    // by the message thread when it changes the particles or camera, and by the GL thread while
+    // the context is created or closed (but not while rendering). Nothing holding it waits on
+    // another thread, so the GL thread can always get it during teardown: a step only signals
+    // the GL thread (triggerRepaint) and never waits on it or the message thread.
     juce::CriticalSection criticalSection;
     HydraAudioProcessor& pluginProcessor;
     juce::OpenGLContext context;
 
-    //========================================================================
-    juce::Random rng;
-    
-    inline float randomFloat(float minValue, float maxValue)
-    {
-        return juce::jmap(rng.nextFloat(), minValue, maxValue);
-    }
-
     //========================================================================
     class Error : public std::exception
     {
@@ -77,16 +80,6 @@ private:
         juce::String message;
     };
     
-    //========================================================================
-    struct Particle
-    {
-        glm::vec3 initialPositionNorm;
-        glm::vec3 velocity;
-        float mouseSnappinessMultiplier;
-        float escapeSnappinessMultiplier;
-        float escapeProbability;
-    };
-    
     //========================================================================
     struct State
     {
@@ -106,26 +99,70 @@ private:
     void recalculateBackgroundUVs();
     
     //========================================================================
-    int64_t lastFrameTime = 0.0;
-    float rotationAngle = 0.0f;
+    /// Steps the simulation at a fixed rate, independently of the GL thread's frame rate
+    class SimulationThread : public juce::Thread
+    {
+    public:
+        SimulationThread(Visualiser& v) : juce::Thread("Visualiser simulation"), visualiser(v) {}
+        void run() override;
+        
+    private:
+        Visualiser& visualiser;
+    };
+    
+    SimulationThread simulationThread { *this };
+    std::atomic<int> simulationTicksPerSecond { 60 };
+    void simulate(float deltaTime, bool advanceRotation = true);
+    
+    // With no input, no mouse and activation settled at zero for a while, the simulation drops to
+    // a low rate until something happens; while the component is hidden it stops altogether.
+    // A rotating model keeps turning at the full rate while idle, but that only needs a new
+    // model matrix and a redraw of the last frame, not a step.
+    static constexpr double c_secondsBeforeIdle = 2.0;
+    static constexpr int c_idleTicksPerSecond = 10;
+    std::atomic<bool> simulationPaused { false };
+    
+    /// Called from the simulation thread
+    bool hasActivity() const;
+    bool isRotating() const;
+    void rotate(float deltaTime);
+    
+    // The model's rotation, kept apart from the frames so the GL thread can redraw the last frame at a new angle
+    std::atomic<float> rotationAngle { 0.0f };
+    
+    // Simulation thread's CPU use, including the particle update's worker threads
+    bsgl::FPSCounter simulationCounter;
+    
+    // Only used on the message thread: fed by simulationCounter's readings, reset in visibilityChanged
+    QualityGovernor qualityGovernor;
+    void updateQuality(double cpuFraction);
+    void resetQuality();
+    void applyQualityLevel();
+    
+    /// Everything the GL thread needs to draw one simulated frame
+    struct Frame
+    {
+        juce::Array<ParticleShader::Instance> instances;
+        glm::mat4 viewMatrix { 1.0f };
+        glm::mat4 projMatrix { 1.0f };
+    };
+    
+    TripleBuffer<Frame> frames;
+    bool instanceDataUploaded = false;
+    
+    //========================================================================
     float activationValue = 0.0f;
+    bool isInputAboveThreshold() const;
+    void updateActivation(float deltaTime);
     
     //========================================================================
     std::atomic<glm::vec2> currentMousePosition { glm::vec2 { -2.0f, -2.0f } };
     glm::vec2 mousePositionLastFrame { 0.0f, 0.0f };
     
     //========================================================================
-    juce::Array<ParticleShader::Instance> instances;
-    juce::Array<Particle> particles;
-    void initParticles(bool clearExisting);
-    void updateParticles(float deltaTime);
-
-    //========================================================================
-    glm::vec3 cameraPos;
-    glm::mat4 modelMatrix, invModelMatrix;
-    glm::mat4 viewMatrix, invViewMatrix;
-    glm::mat4 projMatrix, invProjMatrix;
-    void updateViewProjMatrices();
+    ParticleSimulation simulation { processor };
+    bool hasCamera = false;
+    void updateCamera();
 
     //========================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Visualiser)
@@ -284,6 +284,17 @@ VisualiserProcessor::VisualiserProcessor()
     initRegionParams(Meridian, "Meridian");
     initRegionParams(North, "North");
     initRegionParams(South, "South");
+    
+    addParameter(paramCpuBudget = new juce::AudioParameterFloat
+                 ({ "paramCpuBudget", 1 },
+                  "CPU budget",
+                  juce::NormalisableRange<float>(0.01f, 1.0f),
+                  0.05f,
+                  juce::AudioParameterFloatAttributes()
+                  .withStringFromValueFunction(bsfx::percentToString<1>)
+                  .withValueFromStringFunction(bsfx::stringToPercent)
+                  .withLabel("%")
+                  ));
 }
 
 VisualiserProcessor::ColourParameters::ColourParameters(VisualiserProcessor &proc,
@@ -74,6 +74,9 @@ public:
     std::unique_ptr<ColourParameters> regionColours[c_numRegions];
     juce::AudioParameterFloat* paramRegionRadiusMod[c_numRegions];
     
+    /// Fraction of one core the visualiser (simulation and rendering together) should stay within
+    juce::AudioParameterFloat* paramCpuBudget;
+    
 private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VisualiserProcessor)
 };
@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+    WorkStealingPool.cpp
+    Created: 17 Oct 2026 3:02:44pm
+
+  ==============================================================================
+*/
+
+#include "WorkStealingPool.h"
+
+//==============================================================================
+WorkStealingPool::WorkStealingPool(int numWorkers)
+: ranges(std::make_unique<ChunkRange[]>((size_t)numWorkers + 1))
+{
+    for (int i = 0; i < numWorkers; i++)
+        workers.add(new Worker(*this, i))->startThread();
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    workers.clear();
+}
+
+int WorkStealingPool::getDefaultNumWorkers()
+{
+    return juce::jlimit(0, 3, juce::SystemStats::getNumCpus() - 1);
+}
+
+//==============================================================================
+void WorkStealingPool::runChunks(int numChunks, ChunkFunction function, void* context)
+{
+    const int numParticipants = workers.size() + 1;
+    
+    // Not worth waking anyone up if there's only one chunk
+    if (workers.isEmpty() || numChunks <= 1)
+    {
+        for (int i = 0; i < numChunks; i++)
+            function(context, i);
+        
+        return;
+    }
+    
+    currentFunction = function;
+    currentContext = context;
+    
+    for (int p = 0; p < numParticipants; p++)
+    {
+        ranges[p].next = numChunks * p / numParticipants;
+        ranges[p].end = numChunks * (p + 1) / numParticipants;
+    }
+    
+    busyWorkers = workers.size();
+    for (auto* worker : workers)
+        worker->wake.signal();
+    
+    // The calling thread is the last participant
+    workOnChunks(numParticipants - 1);
+    
+    // Every worker must have left workOnChunks before the ranges can be reused
+    allWorkersDone.wait(-1);
+}
+
+void WorkStealingPool::workOnChunks(int participantIndex)
+{
+    const int numParticipants = workers.size() + 1;
+    
+    // Own range first, then steal from the others in turn
+    for (int i = 0; i < numParticipants; i++)
+    {
+        auto& range = ranges[(participantIndex + i) % numParticipants];
+        
+        for (int chunk = range.next++; chunk < range.end; chunk = range.next++)
+            currentFunction(currentContext, chunk);
+    }
+}
+
+//==============================================================================
+WorkStealingPool::Worker::Worker(WorkStealingPool& p, int index)
+: juce::Thread("Work stealing pool " + juce::String(index))
+, pool(p)
+, participantIndex(index)
+{
+}
+
+WorkStealingPool::Worker::~Worker()
+{
+    signalThreadShouldExit();
+    wake.signal();
+    stopThread(1000);
+}
+
+void WorkStealingPool::Worker::run()
+{
+    for (;;)
+    {
+        wake.wait(-1);
+        
+        if (threadShouldExit())
+            return;
+        
+        pool.workOnChunks(participantIndex);
+        
+        if (--pool.busyWorkers == 0)
+            pool.allWorkersDone.signal();
+    }
+}
@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    WorkStealingPool.h
+    Created: 17 Oct 2026 3:02:44pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/// Small thread pool for splitting a loop into chunks. Each participant (the workers plus the
+/// calling thread) starts with an equal share of the chunks, and steals from the others' shares
+/// once its own is used up, so a participant that gets descheduled doesn't hold up the rest.
+class WorkStealingPool
+{
+public:
+    /// numWorkers does not include the calling thread; 0 runs everything on the calling thread
+    explicit WorkStealingPool(int numWorkers);
+    ~WorkStealingPool();
+    
+    /// Default worker count: one less than the number of cores, up to a small limit
+    static int getDefaultNumWorkers();
+    
+    int getNumWorkers() const { return workers.size(); }
+    
+    /// Calls job(chunkIndex) once for every chunk in [0, numChunks), and returns when all have finished.
+    /// Not re-entrant: only one thread may call run() at a time.
+    template<typename Job>
+    void run(int numChunks, Job&& job)
+    {
+        runChunks(numChunks, [](void* context, int chunk) { (*static_cast<std::remove_reference_t<Job>*>(context))(chunk); }, &job);
+    }
+    
+private:
+    using ChunkFunction = void (*)(void* context, int chunk);
+    
+    class Worker : public juce::Thread
+    {
+    public:
+        Worker(WorkStealingPool& p, int index);
+        ~Worker() override;
+        
+        void run() override;
+        
+        juce::WaitableEvent wake;
+        
+    private:
+        WorkStealingPool& pool;
+        const int participantIndex;
+    };
+    
+    struct ChunkRange
+    {
+        std::atomic<int> next { 0 };
+        int end = 0;
+    };
+    
+    juce::OwnedArray<Worker> workers;
+    std::unique_ptr<ChunkRange[]> ranges;
+    
+    ChunkFunction currentFunction = nullptr;
+    void* currentContext = nullptr;
+    
+    std::atomic<int> busyWorkers { 0 };
+    juce::WaitableEvent allWorkersDone;
+    
+    void runChunks(int numChunks, ChunkFunction function, void* context);
+    void workOnChunks(int participantIndex);
+    
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WorkStealingPool)
+};
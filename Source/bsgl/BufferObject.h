@@ -12,6 +12,7 @@
 
 #include "GLError.h"
 #include "ShaderProgram.h"
+#include "PackedTypes.h"
 
 namespace bsgl {
 
@@ -33,6 +34,12 @@ public:
     
     virtual ~BufferObject()
     {
+        for (auto& fence : m_instanceRegionFences)
+        {
+            if (fence != nullptr)
+                glDeleteSync(fence);
+        }
+        
         glDeleteBuffers(1, &m_vertexBufferObject);
         glDeleteBuffers(1, &m_elementBufferObject);
         glDeleteBuffers(1, &m_instanceBufferObject);
@@ -63,13 +70,17 @@ public:
             glGenBuffers(1, &m_instanceBufferObject);
             glBindBuffer(GL_ARRAY_BUFFER, m_instanceBufferObject);
             
-            for (const AttributeInfo& attrib : getInstanceAttributes())
+            m_instanceAttributes = getInstanceAttributes();
+            for (const AttributeInfo& attrib : m_instanceAttributes)
             {
                 attrib.enable();
                 glVertexAttribDivisor(attrib.m_attributeId, 1);
             }
 
             BSGL_CHECK_ERROR;
+            
+            m_streamingMode = supportsBufferStorage() ? StreamingMode::persistentMapped
+                                                      : StreamingMode::mapUnsynchronized;
         }
         
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -126,15 +137,145 @@ public:
         setBufferData<ArrayType, unsigned int>(data, GL_ELEMENT_ARRAY_BUFFER, usage);
     }
     
+    //=========================================================================
+    /// How instance data is streamed, from best to worst. The best one the context supports is
+    /// chosen by init(), and it drops down the list if mapping fails.
+    enum class StreamingMode
+    {
+        persistentMapped,   // ARB_buffer_storage ring of regions, each guarded by a fence
+        mapUnsynchronized,  // the same ring in ordinary storage, mapping one region per frame
+        bufferData          // glBufferData from a staging copy
+    };
+    
+    StreamingMode getStreamingMode() const { return m_streamingMode; }
+    
+    /// For instance data that changes every frame. Returns somewhere to write numInstances instances,
+    /// which commitInstanceData() must be called for before drawing. Unlike setInstanceData(), the
+    /// buffer is never reallocated while it's big enough, so the driver doesn't have to stall.
+    InstanceType* mapInstanceData(int numInstances)
+    {
+        static_assert(c_isInstanced);
+        
+        glBindVertexArray(m_vertexArrayObject);
+        glBindBuffer(GL_ARRAY_BUFFER, m_instanceBufferObject);
+        
+        if (m_streamingMode != StreamingMode::bufferData)
+        {
+            // Everything drawn from the current region has been issued by now, so fence it off
+            // and move on to the next one, waiting for the GPU if it's still reading from that
+            if (m_currentInstanceRegion >= 0)
+                m_instanceRegionFences[m_currentInstanceRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            
+            // Including the first time, even with no instances, as mapping a buffer with no storage fails
+            if (numInstances > m_instanceCapacity || m_instanceCapacity == 0)
+                allocateInstanceRegions(numInstances);
+            
+            m_currentInstanceRegion = (m_currentInstanceRegion + 1) % c_numInstanceRegions;
+            waitForInstanceRegion(m_currentInstanceRegion);
+        }
+        
+        const auto regionOffset = (GLsizei)(juce::jmax(0, m_currentInstanceRegion) * m_instanceCapacity * sizeof(InstanceType));
+        
+        if (m_streamingMode == StreamingMode::persistentMapped)
+        {
+            for (const AttributeInfo& attrib : m_instanceAttributes)
+                attrib.enable(regionOffset);
+            
+            return reinterpret_cast<InstanceType*>(static_cast<char*>(m_persistentMapping) + regionOffset);
+        }
+        
+        if (m_streamingMode == StreamingMode::mapUnsynchronized)
+        {
+            // The fence has already shown that the GPU is done with this region, so the driver
+            // doesn't need to synchronise, and only the range being written is invalidated
+            const auto numBytes = (GLsizeiptr)(juce::jmax(1, numInstances) * sizeof(InstanceType));
+            if (void* mapping = glMapBufferRange(GL_ARRAY_BUFFER, regionOffset, numBytes,
+                                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT))
+            {
+                for (const AttributeInfo& attrib : m_instanceAttributes)
+                    attrib.enable(regionOffset);
+                
+                m_isInstanceBufferMapped = true;
+                return static_cast<InstanceType*>(mapping);
+            }
+            
+            DBG("glMapBufferRange failed, falling back to glBufferData for instance data");
+            m_streamingMode = StreamingMode::bufferData;
+            m_instanceCapacity = 0;
+            
+            for (const AttributeInfo& attrib : m_instanceAttributes)
+                attrib.enable();
+        }
+        
+        m_instanceStagingData.realloc((size_t)juce::jmax(1, numInstances));
+        m_numStagedInstances = numInstances;
+        return m_instanceStagingData.get();
+    }
+    
+    void commitInstanceData()
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, m_instanceBufferObject);
+        
+        switch (m_streamingMode)
+        {
+            case StreamingMode::persistentMapped:
+                // The mapping is coherent, so there's nothing to flush
+                break;
+                
+            case StreamingMode::mapUnsynchronized:
+                if (m_isInstanceBufferMapped && glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE)
+                    DBG("Instance buffer contents were lost while mapped");
+                m_isInstanceBufferMapped = false;
+                break;
+                
+            case StreamingMode::bufferData:
+                glBufferData(GL_ARRAY_BUFFER,
+                             (GLsizeiptr)(m_numStagedInstances * sizeof(InstanceType)),
+                             m_instanceStagingData.get(),
+                             GL_STREAM_DRAW);
+                break;
+        }
+        
+        BSGL_CHECK_ERROR;
+    }
+    
+    /// Copies instance data that already exists somewhere else (e.g. another thread's frame) into
+    /// the buffer: straight into the mapped region, or to glBufferData with no staging copy.
+    void uploadInstanceData(const InstanceType* data, int numInstances)
+    {
+        if (m_streamingMode == StreamingMode::bufferData)
+        {
+            glBindVertexArray(m_vertexArrayObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_instanceBufferObject);
+            glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(numInstances * sizeof(InstanceType)), data, GL_STREAM_DRAW);
+            
+            BSGL_CHECK_ERROR;
+            return;
+        }
+        
+        // If mapping fails this gets the staging buffer instead, and later uploads take the path above
+        std::copy(data, data + numInstances, mapInstanceData(numInstances));
+        commitInstanceData();
+    }
+    
     //=========================================================================
 protected:
     juce::OpenGLShaderProgram& m_shader;
 
-    template<typename T> static std::pair<GLint, GLenum> getAttributeSizeAndType();
-    template<> static std::pair<GLint, GLenum> getAttributeSizeAndType<float>()     { return { 1, GL_FLOAT }; }
-    template<> static std::pair<GLint, GLenum> getAttributeSizeAndType<glm::vec2>() { return { 2, GL_FLOAT }; }
-    template<> static std::pair<GLint, GLenum> getAttributeSizeAndType<glm::vec3>() { return { 3, GL_FLOAT }; }
-    template<> static std::pair<GLint, GLenum> getAttributeSizeAndType<glm::vec4>() { return { 4, GL_FLOAT }; }
+    struct AttributeFormat
+    {
+        GLint size;
+        GLenum type;
+        GLboolean normalised = GL_FALSE;
+    };
+    
+    template<typename T> static AttributeFormat getAttributeFormat();
+    template<> static AttributeFormat getAttributeFormat<float>()               { return { 1, GL_FLOAT }; }
+    template<> static AttributeFormat getAttributeFormat<glm::vec2>()           { return { 2, GL_FLOAT }; }
+    template<> static AttributeFormat getAttributeFormat<glm::vec3>()           { return { 3, GL_FLOAT }; }
+    template<> static AttributeFormat getAttributeFormat<glm::vec4>()           { return { 4, GL_FLOAT }; }
+    template<> static AttributeFormat getAttributeFormat<HalfVec4>()            { return { 4, GL_HALF_FLOAT }; }
+    template<> static AttributeFormat getAttributeFormat<UByteVec4Normalised>() { return { 4, GL_UNSIGNED_BYTE, GL_TRUE }; }
     
     using TVertex = VertexType;
     using TInstance = InstanceType;
@@ -161,20 +302,21 @@ protected:
         AttributeInfo withType() const
         {
             AttributeInfo result = *this;
-            auto sizeAndType = getAttributeSizeAndType<T>();
-            result.m_size = sizeAndType.first;
-            result.m_type = sizeAndType.second;
+            auto format = getAttributeFormat<T>();
+            result.m_size = format.size;
+            result.m_type = format.type;
+            result.m_normalised = format.normalised;
             return result;
         }
         
-        void enable() const
+        void enable(GLsizei baseOffset = 0) const
         {
             glVertexAttribPointer(m_attributeId,
                                   m_size,
                                   m_type,
-                                  GL_FALSE,
+                                  m_normalised,
                                   m_stride,
-                                  reinterpret_cast<void*>(m_offset));
+                                  reinterpret_cast<void*>((intptr_t)(baseOffset + m_offset)));
             glEnableVertexAttribArray(m_attributeId);
 
             BSGL_CHECK_ERROR;
@@ -186,6 +328,7 @@ protected:
         GLsizei m_offset = 0;
         GLint m_size = 0;
         GLenum m_type = 0;
+        GLboolean m_normalised = GL_FALSE;
     };
     
     struct VertexAttributeInfo : public AttributeInfo {};
@@ -208,6 +351,86 @@ private:
     GLuint m_vertexArrayObject = 0;
     GLuint m_elementBufferObject = 0;
     GLuint m_instanceBufferObject = 0;
+    
+    //=========================================================================
+    juce::Array<AttributeInfo> m_instanceAttributes;
+    StreamingMode m_streamingMode = StreamingMode::bufferData;
+    
+    // Mapped modes: one region is written while up to two earlier ones may still be drawn
+    static constexpr int c_numInstanceRegions = 3;
+    int m_instanceCapacity = 0;
+    int m_currentInstanceRegion = -1;
+    void* m_persistentMapping = nullptr;
+    GLsync m_instanceRegionFences[c_numInstanceRegions] = {};
+    
+    bool m_isInstanceBufferMapped = false;
+    
+    juce::HeapBlock<InstanceType> m_instanceStagingData;
+    int m_numStagedInstances = 0;
+    
+    static bool supportsBufferStorage()
+    {
+        GLint majorVersion = 0, minorVersion = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+        glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+        
+        const bool isCore = majorVersion > 4 || (majorVersion == 4 && minorVersion >= 4);
+        return (isCore || juce::OpenGLHelpers::isExtensionSupported("GL_ARB_buffer_storage"))
+            && glBufferStorage != nullptr;
+    }
+    
+    void waitForInstanceRegion(int region)
+    {
+        if (auto& fence = m_instanceRegionFences[region])
+        {
+            // A second is far longer than any frame; if it times out, carry on rather than hang
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    
+    /// Expects the instance buffer to be bound. Only called when the buffer has to grow.
+    void allocateInstanceRegions(int numInstances)
+    {
+        for (int region = 0; region < c_numInstanceRegions; region++)
+            waitForInstanceRegion(region);
+        
+        m_instanceCapacity = juce::nextPowerOfTwo(juce::jmax(1024, numInstances));
+        m_currentInstanceRegion = -1;
+        
+        const auto numBytes = (GLsizeiptr)(c_numInstanceRegions * m_instanceCapacity * sizeof(InstanceType));
+        
+        if (m_streamingMode == StreamingMode::persistentMapped)
+        {
+            // Buffer storage is immutable, so growing it means starting again with a new buffer
+            glDeleteBuffers(1, &m_instanceBufferObject);
+            glGenBuffers(1, &m_instanceBufferObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_instanceBufferObject);
+            
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_ARRAY_BUFFER, numBytes, nullptr, flags);
+            m_persistentMapping = glMapBufferRange(GL_ARRAY_BUFFER, 0, numBytes, flags);
+            
+            if (m_persistentMapping != nullptr)
+            {
+                BSGL_CHECK_ERROR;
+                return;
+            }
+            
+            DBG("Persistent mapping failed, falling back to glMapBufferRange for instance data");
+            m_streamingMode = StreamingMode::mapUnsynchronized;
+            
+            // The immutable storage can't be respecified, so that needs a new buffer too
+            glDeleteBuffers(1, &m_instanceBufferObject);
+            glGenBuffers(1, &m_instanceBufferObject);
+            glBindBuffer(GL_ARRAY_BUFFER, m_instanceBufferObject);
+        }
+        
+        glBufferData(GL_ARRAY_BUFFER, numBytes, nullptr, GL_STREAM_DRAW);
+        
+        BSGL_CHECK_ERROR;
+    }
 };
 
 //=============================================================================
@@ -42,7 +42,14 @@ public:
         framesThisSecond++;
     }
     
+    /// Counts time spent elsewhere (e.g. on other threads) on behalf of this frame
+    void addTicks(int64_t ticks)
+    {
+        ticksInFrameThisSecond += ticks;
+    }
+    
     int getFPS() { return currentFPS; }
+    double getCPU() { return currentCPU; }
     
     std::function<void(int frames, double cpuTime)> onNewReading = nullptr;
     
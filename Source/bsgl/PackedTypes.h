@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    PackedTypes.h
+    Created: 17 Oct 2026 5:12:09pm
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace bsgl {
+
+//=============================================================================
+/// IEEE 754 half precision float, as read by GL_HALF_FLOAT attributes.
+/// Plain data with no GL dependency, so it can be filled in away from the GL thread.
+struct Half
+{
+    uint16_t bits;
+
+    /// Rounds to nearest even; out of range values become infinity
+    static Half fromFloat(float value)
+    {
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(f));
+
+        const uint32_t sign = (f >> 16) & 0x8000u;
+        f &= 0x7fffffffu;
+
+        uint32_t h;
+        if (f >= 0x47800000u)
+        {
+            // Too big for a half, or already infinity or NaN
+            h = (f > 0x7f800000u) ? 0x7e00u : 0x7c00u;
+        }
+        else if (f < 0x38800000u)
+        {
+            // Subnormal as a half, so shift the implicit leading bit into the mantissa
+            if (f < 0x33000000u)
+            {
+                h = 0;
+            }
+            else
+            {
+                const uint32_t shift = 126 - (f >> 23);
+                const uint32_t mantissa = (f & 0x7fffffu) | 0x800000u;
+                h = (mantissa + (1u << (shift - 1)) - 1 + ((mantissa >> shift) & 1)) >> shift;
+            }
+        }
+        else
+        {
+            // Rebias the exponent; rounding can carry into it, which is correct
+            h = ((f - 0x38000000u) + 0xfffu + ((f >> 13) & 1)) >> 13;
+        }
+
+        return { (uint16_t)(sign | h) };
+    }
+};
+
+struct HalfVec4
+{
+    Half x, y, z, w;
+};
+
+//=============================================================================
+/// Four bytes, read by the shader as floats in [0, 1]
+struct UByteVec4Normalised
+{
+    uint8_t x, y, z, w;
+
+    static uint8_t fromFloat(float value)
+    {
+        // Written so that NaN ends up as 0
+        const float clamped = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+        return (uint8_t)(clamped * 255.0f + 0.5f);
+    }
+
+    static UByteVec4Normalised fromFloats(float x, float y, float z, float w)
+    {
+        return { fromFloat(x), fromFloat(y), fromFloat(z), fromFloat(w) };
+    }
+};
+
+//=============================================================================
+} // namespace bsgl